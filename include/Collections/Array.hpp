@@ -396,11 +396,12 @@ namespace Micro
 	/// <summary>
 	/// Hashes the Array to produce a unique hash code.
 	/// </summary>
+	/// <param name="array">Array to hash</param>
 	/// <returns>Hash code as a 'size_t'</returns>
 	template <typename T, size_t TSize>
-	NODISCARD size_t Hash(const Array<T, TSize>&) noexcept
+	NODISCARD size_t Hash(const Array<T, TSize>& array) noexcept
 	{
-		return typeid(T).hash_code() + typeid(Array<T, TSize>).hash_code() + TSize;
+		return Hash(array.AsSpan());
 	}
 
 	/// <summary>
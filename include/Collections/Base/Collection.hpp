@@ -2,12 +2,19 @@
 #include <ostream>
 
 #include "Core/Memory/Allocator.hpp"
+#include "Core/Memory/GrowthPolicy.hpp"
 #include "Collections/Base/Enumerable.hpp"
 #include "Common/Span.hpp"
 
 namespace Micro
 {
-    template <typename T>
+	/**
+	 * \brief Base of the contiguous heap collections (List, Stack).
+	 * \tparam T Type of elements
+	 * \tparam TAllocator Allocator owning the element block (Allocator&lt;T&gt; goes to the global heap)
+	 * \tparam TGrowth Policy picking the capacity to grow to when the block is full
+	 */
+	template <typename T, CollectionAllocator<T> TAllocator = Allocator<T>, GrowthPolicy TGrowth = DoublingGrowth>
 	class HeapCollection : public Enumerable<T>
 	{
 	public:		
@@ -20,7 +27,13 @@ namespace Micro
 
 		constexpr HeapCollection() noexcept = default;
 
+		constexpr explicit HeapCollection(const TAllocator& allocator) noexcept
+			: m_Allocator(allocator)
+		{
+		}
+
 		constexpr HeapCollection(const HeapCollection& other) noexcept
+			: m_Allocator(other.m_Allocator)
 		{
 			if (other.IsEmpty())
 				return;
@@ -32,7 +45,8 @@ namespace Micro
 		}
 
 		constexpr HeapCollection(HeapCollection&& other) noexcept
-			: m_Data(std::move(other.m_Data)), m_Size(other.m_Size), m_Capacity(other.m_Capacity)
+			: m_Data(std::move(other.m_Data)), m_Size(other.m_Size), m_Capacity(other.m_Capacity),
+			  m_Allocator(std::move(other.m_Allocator))
 		{
 			other.m_Data = nullptr;
 			other.m_Size = 0;
@@ -77,17 +91,14 @@ namespace Micro
 
 		constexpr explicit HeapCollection(const size_t capacity) noexcept { Allocate(capacity); }
 
-		constexpr ~HeapCollection() noexcept override
+		constexpr HeapCollection(const size_t capacity, const TAllocator& allocator) noexcept
+			: m_Allocator(allocator)
 		{
-			// Invalidate memory, then free
-			Allocator<T>::ClearMemory(m_Data, m_Size);
-			Allocator<T>::Dispose(m_Data, m_Capacity);
-
-			m_Data = nullptr;
-			m_Size = 0;
-			m_Capacity = 0;
+			Allocate(capacity);
 		}
 
+		constexpr ~HeapCollection() noexcept override { Release(); }
+
 		
 		/*
 		 *  ============================================================
@@ -101,6 +112,7 @@ namespace Micro
 		NODISCARD constexpr size_t Size() const noexcept { return m_Size; }
 		NODISCARD constexpr size_t Capacity() const noexcept { return m_Capacity; }
 		NODISCARD constexpr Span<T> AsSpan() const noexcept { return {m_Data, m_Size}; }
+		NODISCARD constexpr const TAllocator& GetAllocator() const noexcept { return m_Allocator; }
 
 		/* Enumerators (Iterators) */
 
@@ -147,10 +159,31 @@ namespace Micro
 		constexpr void Clear() noexcept
 		{
 			// Invalidate data
-			Allocator<T>::ClearMemory(m_Data, m_Size);
+			m_Allocator.ClearMemory(m_Data, m_Size);
 			m_Size = 0;
 		}
 
+		/// <summary>
+		/// Makes room for the given number of elements, so adding up to it doesn't reallocate. Never shrinks.
+		/// </summary>
+		/// <param name="capacity">Number of elements to make room for</param>
+		constexpr void Reserve(const size_t capacity) noexcept
+		{
+			if (capacity > m_Capacity)
+				Reallocate(capacity);
+		}
+
+		/// <summary>
+		/// Reallocates the block to fit the elements exactly, or releases it if the collection is empty.
+		/// </summary>
+		constexpr void ShrinkToFit() noexcept
+		{
+			if (m_Size == 0)
+				Release();
+			else if (m_Capacity > m_Size)
+				Reallocate(m_Size);
+		}
+
 
 		/*
 		 *  ============================================================
@@ -167,16 +200,16 @@ namespace Micro
 			if (this == &other)
 				return *this;
 
-			if (other.m_Capacity == 0)
+			Clear();
+			if (other.m_Size == 0)
 				return *this;
 
-			// Allocation
-			if (m_Data.IsValidMemory())
-				Reallocate(other.m_Capacity);
-			else
+			// Allocation (the current block is reused when it is large enough)
+			if (m_Capacity < other.m_Size)
+			{
+				Release();
 				Allocate(other.m_Capacity);
-
-			m_Size = other.m_Size;
+			}
 
 			// Assignment
 			CopyFrom(other);
@@ -188,9 +221,10 @@ namespace Micro
 			if (this == &other)
 				return *this;
 
-			if (!IsEmpty())
-				Clear();
+			// The block belongs to the other allocator, so it comes along with it
+			Release();
 
+			m_Allocator = std::move(other.m_Allocator);
 			m_Data = other.m_Data;
 			m_Size = other.m_Size;
 			m_Capacity = other.m_Capacity;
@@ -226,29 +260,63 @@ namespace Micro
 		
 		constexpr void Allocate(const size_t capacity) noexcept
 		{
-			m_Capacity = Allocator<T>::Allocate(m_Data, m_Capacity, capacity);
+			TRACK_ALLOCATION_OWNER(HeapCollection);
+			m_Capacity = m_Allocator.Allocate(m_Data, m_Capacity, capacity);
 		}
 
 		constexpr void Reallocate(const size_t capacity) noexcept
 		{
-			m_Capacity = Allocator<T>::Reallocate(m_Data, m_Capacity, capacity);
+			TRACK_ALLOCATION_OWNER(HeapCollection);
+			m_Capacity = m_Allocator.Reallocate(m_Data, m_Size, m_Capacity, capacity);
+			m_Size = MIN(m_Size, m_Capacity);
 		}
 
 		/// <summary>
-		/// Determines the correct capacity to allocate or reallocate with. (Reallocates with
-		///	'capacity + (capacity / 2)', but uses the expected capacity when above that calculated value) 
+		/// Destroys the elements and gives the block back to the allocator.
+		/// </summary>
+		constexpr void Release() noexcept
+		{
+			m_Allocator.ClearMemory(m_Data, m_Size);
+			m_Allocator.Dispose(m_Data, m_Capacity);
+
+			m_Data = nullptr;
+			m_Size = 0;
+			m_Capacity = 0;
+		}
+
+		/// <summary>
+		/// Grows the block when the expected capacity doesn't fit, to the capacity chosen by the growth policy.
 		/// </summary>
 		/// <param name="expectedCapacity">Expected capacity to allocate with</param>
 		constexpr void HandleReallocation(const size_t expectedCapacity) noexcept
 		{
 			if (expectedCapacity > m_Capacity)
-				Reallocate(MAX(m_Capacity + (m_Capacity / 2), expectedCapacity));
+				Reallocate(TGrowth::Grow(m_Capacity, expectedCapacity, sizeof(T)));
 		}
 
+		/// <summary>
+		/// Grows the block for one more element and creates it at the end. The value is created before the elements
+		/// are relocated, so the arguments may refer to one of them.
+		/// </summary>
+		template <typename... Args>
+		constexpr T& GrowAndEmplace(Args&&... args) noexcept
+		{
+			T value(std::forward<Args>(args)...);
+			HandleReallocation(m_Size + 1);
+
+			new(&m_Data[m_Size]) T(std::move(value));
+			return m_Data[m_Size++];
+		}
+
+		/// <summary>
+		/// Copy constructs the elements of the other collection into this (empty) collection's block.
+		/// </summary>
 		constexpr void CopyFrom(const HeapCollection& other) noexcept
 		{
 			for (size_t i = 0; i < other.m_Size; i++)
-				m_Data[i] = other.m_Data[i];
+				new(&m_Data[i]) T(other.m_Data[i]);
+
+			m_Size = other.m_Size;
 		}
 
 		constexpr void MoveFrom(HeapCollection&& other) noexcept
@@ -261,6 +329,7 @@ namespace Micro
 		Memory<T> m_Data = nullptr;
 		size_t m_Size = 0;
 		size_t m_Capacity = 0;
+		NO_UNIQUE_ADDRESS TAllocator m_Allocator{};
 	};
 
 
@@ -22,7 +22,8 @@ namespace Micro
 
 		NODISCARD constexpr auto yield_value(std::convertible_to<T> auto&& value) const noexcept
 		{
-			Current = std::forward<T>(value);
+			// Only moves from rvalues; lvalues (the elements of the collection) bind here as well and are copied
+			Current = std::forward<decltype(value)>(value);
 			return std::suspend_always();
 		}
 
@@ -1,181 +1,109 @@
 #pragma once
 #include "Core/Hash.hpp"
+#include "Common/Span.hpp"
+#include "Utility/Tuple.hpp"
 #include "Collections/Base/Internal/HashTableInternal.hpp"
 #include "Collections/Base/Enumerable.hpp"
+#include "Utility/Options/Optional.hpp"
 
 namespace Micro
 {
-	template <typename T>
+	template <typename TNode>
 	class HashTableAllocator final
 	{
 	public:
-		using Node = Internal::HashNode<T>;
-		using MetaData = Internal::MetaData<Node>;
-		using Memory = Memory<Node>;
+		using Node = TNode;
+		using OccupancyIndex = Internal::OccupancyIndex;
 
-		NODISCARD constexpr static size_t Allocate(Memory& data, const size_t currentCapacity, const size_t newCapacity) noexcept
+		NODISCARD static size_t Allocate(Memory<Node>& data, i8*& control, OccupancyIndex& occupancy,
+		                                 const size_t currentCapacity, const size_t newCapacity) noexcept
 		{
 			// Don't allocate if same capacity
 			if (currentCapacity == newCapacity)
 				return currentCapacity;
 
-			data = Alloc<Node>(newCapacity);
+			// Large tables get their blocks mapped with huge pages (see 'AlignedAlloc')
+			data = AlignedAlloc<Node>(newCapacity, alignof(Node));
+			control = AlignedAlloc<i8>(newCapacity, alignof(i8));
+			occupancy.Slots = AlignedAlloc<size_t>(newCapacity, alignof(size_t));
+			occupancy.Positions = AlignedAlloc<size_t>(newCapacity, alignof(size_t));
+			for (size_t i = 0; i < newCapacity; i++)
+				control[i] = Internal::EmptyControl;
+
 			return newCapacity;
 		}
 
-		NODISCARD constexpr static size_t Reallocate(Memory& data, MetaData*& metaData, const size_t currentCapacity,
-		                                   const size_t newCapacity) noexcept
+		NODISCARD static size_t Reallocate(Memory<Node>& data, i8*& control, OccupancyIndex& occupancy, const size_t size,
+		                                   const size_t currentCapacity, const size_t newCapacity) noexcept
 		{
-			// Don't reallocate if same capacity
-			if (currentCapacity == newCapacity)
-				return currentCapacity;
-
 			// Allocate (without constructor call)
-			Node* newBlock = Alloc<Node>(newCapacity);
-			MetaData* newMetaData = nullptr;
+			Memory<Node> newBlock = nullptr;
+			i8* newControl = nullptr;
+			OccupancyIndex newOccupancy;
+			(void)Allocate(newBlock, newControl, newOccupancy, 0, newCapacity);
 
-			// Re-hash using meta data
-			auto metaNode = metaData;
-			while (metaNode != nullptr)
+			// Re-hash in occupancy order (same capacity is allowed, which purges deleted slots)
+			for (size_t position = 0; position < size; position++)
 			{
-				auto valueNode = metaNode->BucketReference;
-				while (valueNode != nullptr)
-				{
-					// Get new hash of value
-					const size_t hash = Hash(valueNode->GetKey()) % newCapacity;
-
-					// Check if bucket is valid
-					auto bucket = &newBlock[hash];
-					if (bucket->IsValid())
-					{
-						// Get to the end of the chain
-						auto node = bucket;
-						while (node->Next != nullptr)
-							node = node->Next;
-
-						// Create new node
-						auto newNode = Alloc<Node>(1);
-						new(newNode) Node(std::move(valueNode->Value));
-
-						node->Next = newNode;
-
-						// Update meta data with new pointer reference
-						AddMetaData(newMetaData, newNode, hash);
-					}
-					else
-					{
-						// Move value into new block
-						new(&newBlock[hash]) Node(std::move(valueNode->Value));
-
-						// Update meta data with new pointer reference
-						AddMetaData(newMetaData, &newBlock[hash], hash);
-					}
-
-					valueNode = valueNode->Next;
-				}
+				auto& valueNode = data[occupancy[position]];
 
-				metaNode = metaNode->Next;
-			}
+				// Get new slot of value
+				const size_t hash = Internal::MixHash(Hash(valueNode.GetKey()));
+				const size_t index = Internal::FindFirstNonFull(newControl, newCapacity, hash);
 
-			// Invalidate memory
-			ClearMemory(metaData);
+				// Move value into new block
+				new(&newBlock[index]) Node(std::move(valueNode));
+				valueNode.~Node();
+				newControl[index] = Internal::H2(hash);
+				newOccupancy.Add(index, position);
+			}
 
 			// Free invalid memory
-			Dispose(data, currentCapacity);
+			Dispose(data, control, occupancy, currentCapacity);
 
 			data = newBlock;
-			metaData = newMetaData;
+			control = newControl;
+			occupancy = newOccupancy;
 			return newCapacity;
 		}
 
-		static void ClearMemory(MetaData* metaData) noexcept
+		static void ClearMemory(Memory<Node>& data, i8* control, const OccupancyIndex& occupancy, const size_t size,
+		                        const size_t capacity) noexcept
 		{
-			// Clear meta data
-			if (metaData == nullptr)
-				return;
-
-			auto metaDataIter = metaData;
-			while (metaDataIter != nullptr)
-			{
-				// Delete children nodes
-				DeleteNodeChildren(metaDataIter->BucketReference);
-
-				// Free bucket head
-				auto next = metaDataIter->Next;
-				metaDataIter->BucketReference->Dispose();
-				metaDataIter->Invalidate();
-
-				metaDataIter = next;
-			}
-		}
+			// Destroy live slots, then reset control bytes (including deleted ones)
+			for (size_t position = 0; position < size; position++)
+				data[occupancy[position]].~Node();
 
-		constexpr static void Dispose(Memory& data, const size_t capacity) noexcept
-		{
-			static_assert(capacity > 0);
-			Delete(data.Data, capacity);
+			for (size_t i = 0; i < capacity; i++)
+				control[i] = Internal::EmptyControl;
 		}
 
-		static void AddMetaData(MetaData*& metaData, Node* node, const size_t hash) noexcept
+		static void Dispose(Memory<Node>& data, i8*& control, OccupancyIndex& occupancy, const size_t capacity) noexcept
 		{
-			// Initial node
-			if (metaData == nullptr)
-			{
-				metaData = Alloc<MetaData>(1);
-				new(metaData) MetaData(node, hash);
+			if (capacity == 0)
 				return;
-			}
-
-			// Subsequent nodes...
-			auto metaDataNode = metaData;
-			while (metaDataNode->Next != nullptr)
-				metaDataNode = metaDataNode->Next;
-
-			auto newNode = Alloc<MetaData>(1);
-			new(newNode) MetaData(node, hash);
 
-			metaDataNode->Next = newNode;
-		}
-
-		static void RemoveMetaData(MetaData*& metaData, Node* node) noexcept
-		{
-			// Initial node
-			if (metaData == nullptr)
-				return;
-
-			// Search for existing node
-			if (metaData->BucketReference != node)
-				return;
-
-			// Remove bucket
-			auto head = metaData;
-			metaData = metaData->Next;
-
-			head->Invalidate();
-			delete head;
-		}
-
-	private:
-		constexpr static void DeleteNodeChildren(Node* head) noexcept
-		{
-			// Clear node chain
-			auto node = head->Next;
-			while (node != nullptr)
-			{
-				auto next = node->Next;
-
-				node->Invalidate();
-				delete node;
-
-				node = next;
-			}
-
-			head->Next = nullptr;
+			AlignedDelete(data.Data, capacity, alignof(Node));
+			AlignedDelete(control, capacity, alignof(i8));
+			AlignedDelete(occupancy.Slots, capacity, alignof(size_t));
+			AlignedDelete(occupancy.Positions, capacity, alignof(size_t));
+			data = nullptr;
+			control = nullptr;
+			occupancy = OccupancyIndex{};
 		}
 	};
 
 
-	template <typename T>
-	class HashTable : public Enumerable<T>
+	/**
+	 * \brief Open-addressing hash table that stores its nodes in one flat block. Every slot has a control byte,
+	 *		  and lookups probe the control bytes a group (16 slots) at a time before ever touching a node.
+	 *		  Growth either rehashes every node at once, or (with incremental rehashing enabled) keeps the old
+	 *		  block alive and migrates a few nodes per insertion and lookup, so no single call pays for the
+	 *		  whole resize.
+	 * \tparam TNode Node type stored in each slot (defines the key, value, and iterator types)
+	 */
+	template <typename TNode>
+	class HashTable : public Enumerable<typename TNode::IteratorType>
 	{
 	public:
 		/*
@@ -185,12 +113,12 @@ namespace Micro
 		 */
 
 
-		using Node = Internal::HashNode<T>;
-		using MetaData = Internal::MetaData<Node>;
-		using Memory = Memory<Node>;
-		using Allocator = HashTableAllocator<T>;
+		using Node = TNode;
+		using KeyType = typename Node::KeyType;
+		using IteratorType = typename Node::IteratorType;
+		using Allocator = HashTableAllocator<Node>;
+
 
-		
 		/*
 		 *  ============================================================
 		 *	|                  Constructors/Destructors                |
@@ -198,50 +126,60 @@ namespace Micro
 		 */
 
 
-		constexpr HashTable() noexcept { Allocate(DefaultCapacity);	}
+		constexpr HashTable() noexcept { Allocate(DefaultCapacity); }
 
 		constexpr HashTable(const HashTable& hashTable) noexcept
-			: m_LoadFactor(hashTable.m_LoadFactor)
+			: m_LoadFactor(hashTable.m_LoadFactor), m_IncrementalRehash(hashTable.m_IncrementalRehash)
 		{
+			if (hashTable.m_Capacity == 0)
+				return;
+
 			Allocate(hashTable.m_Capacity);
 			CopyFrom(hashTable);
 		}
 
 		constexpr HashTable(HashTable&& hashTable) noexcept
-			: m_Data(std::move(hashTable.m_Data)), m_MetaData(hashTable.m_MetaData), m_Size(hashTable.m_Size),
-			  m_Capacity(hashTable.m_Capacity),
-			  m_LoadFactor(hashTable.m_LoadFactor)
+			: m_Data(std::move(hashTable.m_Data)), m_Control(hashTable.m_Control), m_Occupancy(hashTable.m_Occupancy),
+			  m_Size(hashTable.m_Size), m_Deleted(hashTable.m_Deleted), m_Capacity(hashTable.m_Capacity),
+			  m_LoadFactor(hashTable.m_LoadFactor), m_OldData(std::move(hashTable.m_OldData)),
+			  m_OldControl(hashTable.m_OldControl), m_OldOccupancy(hashTable.m_OldOccupancy),
+			  m_OldSize(hashTable.m_OldSize), m_OldCapacity(hashTable.m_OldCapacity),
+			  m_IncrementalRehash(hashTable.m_IncrementalRehash)
 		{
 			hashTable.m_Data = nullptr;
-			hashTable.m_MetaData = nullptr;
+			hashTable.m_Control = nullptr;
+			hashTable.m_Occupancy = Internal::OccupancyIndex{};
 			hashTable.m_Size = 0;
+			hashTable.m_Deleted = 0;
 			hashTable.m_Capacity = 0;
-			hashTable.m_LoadFactor = 0;
+			hashTable.ForgetOld();
 		}
 
-		constexpr explicit HashTable(std::initializer_list<T>&& initializerList) noexcept
+		constexpr explicit HashTable(std::initializer_list<IteratorType>&& initializerList) noexcept
 		{
-			const size_t length = initializerList.size();
-			if (length == 0)
-				return;
-
-			Allocate(MAX(length, DefaultCapacity));
+			Allocate(CapacityFor(initializerList.size()));
 
 			for (auto& e : initializerList)
-				Insert(std::move(const_cast<T&>(e)));
+				Insert(std::move(const_cast<IteratorType&>(e)));
+		}
+
+		/// <summary>
+		/// Builds the table from a range of values, sized once so that no insertion ever rehashes.
+		/// </summary>
+		/// <param name="values">Values to insert (duplicates after the first are ignored)</param>
+		constexpr explicit HashTable(const Span<IteratorType>& values) noexcept
+		{
+			Allocate(CapacityFor(values.Capacity()));
+			(void)InsertRange(values.Data(), values.Capacity());
 		}
 
 		constexpr explicit HashTable(const size_t capacity) noexcept { Allocate(capacity); }
 
 		constexpr ~HashTable() noexcept override
 		{
-			Allocator::ClearMemory(m_MetaData);
-			Allocator::Dispose(m_Data, m_Capacity);
-			m_Data = nullptr;
-			m_MetaData = nullptr;
-			m_Size = 0;
+			Clear();
+			Allocator::Dispose(m_Data, m_Control, m_Occupancy, m_Capacity);
 			m_Capacity = 0;
-			m_LoadFactor = 0;
 		}
 
 
@@ -252,13 +190,69 @@ namespace Micro
 		 */
 
 
-		constexpr void SetLoadFactor(const double_t loadFactor) noexcept { m_LoadFactor = loadFactor; }
+		/// <summary>
+		/// Sets the maximum ratio of occupied (live or deleted) slots before the table grows. Clamped so at least
+		/// one slot per probe sequence always stays empty.
+		/// </summary>
+		/// <param name="loadFactor">Load factor in the range (0, 1)</param>
+		constexpr void SetLoadFactor(const double_t loadFactor) noexcept
+		{
+			m_LoadFactor = MIN(MAX(loadFactor, MinLoadFactor), MaxLoadFactor);
+		}
+
+		/// <summary>
+		/// Enables or disables incremental rehashing. When enabled, growing keeps the old block alive and every
+		/// insertion (and non-const lookup) moves a bounded number of nodes into the new one. Disabling it
+		/// finishes any migration that is still in progress.
+		/// </summary>
+		/// <param name="enabled">Whether growth should be spread over later operations</param>
+		constexpr void SetIncrementalRehash(const bool enabled) noexcept
+		{
+			m_IncrementalRehash = enabled;
+			if (!enabled)
+				RehashStep(m_OldSize);
+		}
+
+		/// <summary>
+		/// Grows the table so that the given number of elements fit without exceeding the load factor. Never shrinks.
+		/// </summary>
+		/// <param name="count">Number of elements to make room for</param>
+		constexpr void Reserve(const size_t count) noexcept
+		{
+			if (const size_t capacity = CapacityFor(count); capacity > m_Capacity)
+				Reallocate(capacity);
+		}
+
+		/// <summary>
+		/// Rehashes into the smallest block that holds the elements within the load factor, which also purges
+		/// deleted slots, or frees the block if the table is empty.
+		/// </summary>
+		constexpr void ShrinkToFit() noexcept
+		{
+			if (m_Size == 0)
+			{
+				Clear();
+				Allocator::Dispose(m_Data, m_Control, m_Occupancy, m_Capacity);
+				m_Capacity = 0;
+				m_Deleted = 0;
+			}
+			else if (const size_t capacity = CapacityFor(m_Size); capacity < m_Capacity || m_Deleted != 0)
+				Reallocate(capacity);
+		}
 
 		constexpr void Clear() noexcept
 		{
-			Allocator::ClearMemory(m_MetaData);
-			m_MetaData = nullptr;
+			if (m_Capacity != 0)
+				Allocator::ClearMemory(m_Data, m_Control, m_Occupancy, m_Size - m_OldSize, m_Capacity);
+
+			if (m_OldCapacity != 0)
+			{
+				Allocator::ClearMemory(m_OldData, m_OldControl, m_OldOccupancy, m_OldSize, m_OldCapacity);
+				DisposeOld();
+			}
+
 			m_Size = 0;
+			m_Deleted = 0;
 		}
 
 
@@ -270,32 +264,37 @@ namespace Micro
 
 
 		NODISCARD constexpr bool IsEmpty() const noexcept { return m_Size == 0; }
-		NODISCARD constexpr const MetaData* Data() const noexcept { return m_MetaData; }
 		NODISCARD constexpr size_t Size() const noexcept { return m_Size; }
 		NODISCARD constexpr size_t Capacity() const noexcept { return m_Capacity; }
 		NODISCARD constexpr double_t LoadFactor() const noexcept { return m_LoadFactor; }
+		NODISCARD constexpr bool IsIncrementalRehash() const noexcept { return m_IncrementalRehash; }
+
+		/// <summary>
+		/// Checks if nodes are still being migrated out of the block the table grew from.
+		/// </summary>
+		NODISCARD constexpr bool IsRehashing() const noexcept { return m_OldSize != 0; }
 
 		/* Enumerators (Iterators) */
 
-		NODISCARD Enumerator<T> GetEnumerator() override
+		NODISCARD Enumerator<IteratorType> GetEnumerator() override
 		{
 			for (size_t i = 0; i < m_Size; i++)
 			{
-				auto& element = m_Data[i];
+				auto& element = NodeAt(i).GetIteratorValue();
 				co_yield element;
 			}
 		}
 
-		NODISCARD Enumerator<T> GetEnumerator() const override
+		NODISCARD Enumerator<IteratorType> GetEnumerator() const override
 		{
 			for (size_t i = 0; i < m_Size; i++)
 			{
-				const auto& element = m_Data[i];
+				const auto& element = NodeAt(i).GetIteratorValue();
 				co_yield element;
 			}
 		}
 
-		
+
 		/*
 		 *  ============================================================
 		 *	|                    Operator Overloads                    |
@@ -308,9 +307,17 @@ namespace Micro
 			if (this == &other)
 				return *this;
 
-			if (!IsEmpty())
-				Clear();
+			Clear();
+
+			if (m_Capacity != other.m_Capacity)
+			{
+				Allocator::Dispose(m_Data, m_Control, m_Occupancy, m_Capacity);
+				m_Capacity = 0;
+				Allocate(other.m_Capacity);
+			}
 
+			m_LoadFactor = other.m_LoadFactor;
+			m_IncrementalRehash = other.m_IncrementalRehash;
 			CopyFrom(other);
 			return *this;
 		}
@@ -320,20 +327,30 @@ namespace Micro
 			if (this == &other)
 				return *this;
 
-			if (!IsEmpty())
-				Clear();
+			Clear();
+			Allocator::Dispose(m_Data, m_Control, m_Occupancy, m_Capacity);
 
 			m_Data = other.m_Data;
-			m_MetaData = other.m_MetaData;
+			m_Control = other.m_Control;
+			m_Occupancy = other.m_Occupancy;
 			m_Size = other.m_Size;
+			m_Deleted = other.m_Deleted;
 			m_Capacity = other.m_Capacity;
 			m_LoadFactor = other.m_LoadFactor;
+			m_OldData = other.m_OldData;
+			m_OldControl = other.m_OldControl;
+			m_OldOccupancy = other.m_OldOccupancy;
+			m_OldSize = other.m_OldSize;
+			m_OldCapacity = other.m_OldCapacity;
+			m_IncrementalRehash = other.m_IncrementalRehash;
 
 			other.m_Data = nullptr;
-			other.m_MetaData = nullptr;
+			other.m_Control = nullptr;
+			other.m_Occupancy = Internal::OccupancyIndex{};
 			other.m_Size = 0;
+			other.m_Deleted = 0;
 			other.m_Capacity = 0;
-			other.m_LoadFactor = 0;
+			other.ForgetOld();
 
 			return *this;
 		}
@@ -342,22 +359,11 @@ namespace Micro
 		{
 			stream << "[";
 
-			size_t counter = 0;
-			auto metaDataNode = hashTable.m_MetaData;
-			while (metaDataNode != nullptr)
+			for (size_t i = 0; i < hashTable.m_Size; i++)
 			{
-				auto node = metaDataNode->BucketReference;
-				while (node != nullptr)
-				{
-					stream << node->Value;
-					node = node->Next;
-					counter++;
-
-					if (counter < hashTable.m_Size)
-						stream << ", ";
-				}
-
-				metaDataNode = metaDataNode->Next;
+				stream << hashTable.NodeAt(i).GetIteratorValue();
+				if (i + 1 < hashTable.m_Size)
+					stream << ", ";
 			}
 
 			stream << "]";
@@ -365,345 +371,442 @@ namespace Micro
 		}
 
 	protected:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
 		constexpr void Allocate(const size_t capacity) noexcept
 		{
-			m_Capacity = Allocator::Allocate(m_Data, m_Capacity, capacity);
+			TRACK_ALLOCATION_OWNER(HashTable);
+			m_Capacity = Allocator::Allocate(m_Data, m_Control, m_Occupancy, m_Capacity,
+			                                 Internal::NormalizeCapacity(capacity));
 		}
 
 		constexpr void Reallocate(const size_t capacity) noexcept
 		{
-			m_Capacity = Allocator::Reallocate(m_Data, m_MetaData, m_Capacity, capacity);
+			// The allocator only knows about one block, so any pending migration is finished first
+			RehashStep(m_OldSize);
+
+			TRACK_ALLOCATION_OWNER(HashTable);
+			m_Capacity = Allocator::Reallocate(m_Data, m_Control, m_Occupancy, m_Size, m_Capacity,
+			                                   Internal::NormalizeCapacity(capacity));
+			m_Deleted = 0;
 		}
 
 		constexpr void CopyFrom(const HashTable& other) noexcept
 		{
-			// TODO: Refactor
-			auto data = other.m_Data;
+			// Same capacity, so every node of the other's current block keeps its slot
 			for (size_t i = 0; i < other.m_Capacity; i++)
 			{
-				if (data[i].IsValid())
+				const i8 control = other.m_Control[i];
+				m_Control[i] = control;
+
+				if (Internal::IsFull(control))
+					new(&m_Data[i]) Node(other.m_Data[i]);
+			}
+
+			m_Size = other.m_Size - other.m_OldSize;
+			for (size_t i = 0; i < m_Size; i++)
+				m_Occupancy.Add(other.m_Occupancy[i], i);
+
+			m_Deleted = other.m_Deleted;
+
+			// Nodes the other table hasn't migrated yet are rehashed straight into this block
+			for (size_t i = 0; i < other.m_OldSize; i++)
+			{
+				const Node& node = other.m_OldData[other.m_OldOccupancy[i]];
+				Emplace(HashOf(node.GetKey()), node, m_Size);
+				++m_Size;
+			}
+		}
+
+		/// <summary>
+		/// Searches the probe sequence of the key for the slot that holds it (in both blocks while rehashing).
+		/// </summary>
+		/// <param name="key">Key to search for</param>
+		/// <returns>Pointer to the node, or null if not found</returns>
+		NODISCARD Node* FindNode(const KeyType& key) const noexcept { return Lookup(key, HashOf(key)); }
+
+		/// <summary>
+		/// Same as the const overload, but also advances a pending incremental rehash.
+		/// </summary>
+		NODISCARD Node* FindNode(const KeyType& key) noexcept
+		{
+			if (IsRehashing())
+				RehashStep();
+
+			return Lookup(key, HashOf(key));
+		}
+
+		/// <summary>
+		/// Searches for the key that compares equal to the lookup value, without converting it to the key type.
+		/// </summary>
+		/// <param name="key">Lookup value that hashes and compares like the key type</param>
+		/// <returns>Pointer to the node, or null if not found</returns>
+		template <TransparentKey<KeyType> TLookup>
+		NODISCARD Node* FindNode(const TLookup& key) const noexcept { return Lookup(key, HashOf(key)); }
+
+		template <TransparentKey<KeyType> TLookup>
+		NODISCARD Node* FindNode(const TLookup& key) noexcept
+		{
+			if (IsRehashing())
+				RehashStep();
+
+			return Lookup(key, HashOf(key));
+		}
+
+		/// <summary>
+		/// Same as FindNode, for callers that already computed 'HashOf(key)' (e.g. to pick a shard).
+		/// Doesn't advance a pending incremental rehash.
+		/// </summary>
+		template <typename TLookup>
+		NODISCARD Node* FindNode(const TLookup& key, const size_t hash) const noexcept { return Lookup(key, hash); }
+
+		bool Insert(const IteratorType& value) noexcept
+		{
+			const KeyType& key = Node::KeyOf(value);
+			return InsertUnique(key, HashOf(key), value);
+		}
+
+		bool Insert(IteratorType&& value) noexcept
+		{
+			const KeyType& key = Node::KeyOf(value);
+			return InsertUnique(key, HashOf(key), std::move(value));
+		}
+
+		bool Insert(const IteratorType& value, const size_t hash) noexcept
+		{
+			return InsertUnique(Node::KeyOf(value), hash, value);
+		}
+
+		bool Insert(IteratorType&& value, const size_t hash) noexcept
+		{
+			return InsertUnique(Node::KeyOf(value), hash, std::move(value));
+		}
+
+		/// <summary>
+		/// Finds the node of the key, or inserts the value returned by 'makeValue' (only called when the key is
+		/// missing). The key is hashed once for both the lookup and the insertion.
+		/// </summary>
+		/// <param name="key">Key to find</param>
+		/// <param name="makeValue">Callable returning the value to insert, whose key must equal 'key'</param>
+		/// <returns>Node of the key, and whether it was inserted</returns>
+		template <typename TMakeValue>
+		Tuple<Node*, bool> FindOrInsert(const KeyType& key, TMakeValue&& makeValue) noexcept
+		{
+			const size_t hash = HashOf(key);
+			if (Node* node = Lookup(key, hash))
+				return { node, false };
+
+			PrepareInsert();
+			Node& node = Emplace(hash, makeValue(), m_Size - m_OldSize);
+			++m_Size;
+			return { &node, true };
+		}
+
+		bool Erase(const KeyType& key) noexcept { return Erase(key, HashOf(key)); }
+
+		bool Erase(const KeyType& key, const size_t hash) noexcept
+		{
+			if (const Optional<size_t> result = FindIndex(m_Data, m_Control, m_Capacity, key, hash); result.IsValid())
+			{
+				const size_t index = result.Value();
+				m_Occupancy.Remove(index, m_Size - m_OldSize - 1);
+				m_Data[index].~Node();
+
+				if (MarkErased(m_Control, index))
+					++m_Deleted;
+
+				--m_Size;
+				return true;
+			}
+
+			// Not migrated yet, so remove it from the old block (which never receives insertions again)
+			if (const Optional<size_t> result = FindIndex(m_OldData, m_OldControl, m_OldCapacity, key, hash); result.IsValid())
+			{
+				const size_t index = result.Value();
+				m_OldOccupancy.Remove(index, m_OldSize - 1);
+				m_OldData[index].~Node();
+				(void)MarkErased(m_OldControl, index);
+
+				--m_OldSize;
+				--m_Size;
+				if (m_OldSize == 0)
+					DisposeOld();
+
+				return true;
+			}
+
+			return false;
+		}
+
+		/// <summary>
+		/// Inserts a range of values after making room for all of them at once, so the per-insertion threshold
+		/// check (and any intermediate rehash) is skipped.
+		/// </summary>
+		/// <param name="values">Pointer to the first value</param>
+		/// <param name="count">Number of values</param>
+		/// <returns>Number of values that were inserted (values with an existing key are skipped)</returns>
+		size_t InsertRange(const IteratorType* values, const size_t count) noexcept
+		{
+			// Deleted slots count towards the load, but the rehash purges them
+			if (static_cast<double_t>(m_Size + m_Deleted + count) > static_cast<double_t>(m_Capacity) * m_LoadFactor)
+				Reallocate(MAX(CapacityFor(m_Size + count), m_Capacity));
+
+			size_t inserted = 0;
+			for (size_t i = 0; i < count; i++)
+			{
+				const KeyType& key = Node::KeyOf(values[i]);
+				const size_t hash = HashOf(key);
+				if (HasKey(key, hash))
+					continue;
+
+				Emplace(hash, values[i], m_Size - m_OldSize);
+				++m_Size;
+				++inserted;
+			}
+
+			return inserted;
+		}
+
+		/// <summary>
+		/// Hash the table probes with: the key's Hash, mixed so both the probe position and the control tag stay
+		/// well distributed.
+		/// </summary>
+		template <typename TLookup>
+		NODISCARD static size_t HashOf(const TLookup& key) noexcept { return Internal::MixHash(Hash(key)); }
+
+		NODISCARD constexpr bool IsWithinThreshold() const noexcept
+		{
+			return static_cast<double_t>(m_Size + m_Deleted + 1) <= static_cast<double_t>(m_Capacity) * m_LoadFactor;
+		}
+
+		/// <summary>
+		/// Gets the node at the given position (0 to Size - 1). Nodes that still wait for migration come first.
+		/// </summary>
+		NODISCARD constexpr Node& NodeAt(const size_t position) noexcept
+		{
+			return position < m_OldSize ? m_OldData[m_OldOccupancy[position]] : m_Data[m_Occupancy[position - m_OldSize]];
+		}
+
+		NODISCARD constexpr const Node& NodeAt(const size_t position) const noexcept
+		{
+			return position < m_OldSize ? m_OldData[m_OldOccupancy[position]] : m_Data[m_Occupancy[position - m_OldSize]];
+		}
+
+	private:
+		template <typename TLookup>
+		NODISCARD Node* Lookup(const TLookup& key, const size_t hash) const noexcept
+		{
+			if (const Optional<size_t> index = FindIndex(m_Data, m_Control, m_Capacity, key, hash); index.IsValid())
+				return &m_Data.Data[index.Value()];
+
+			if (const Optional<size_t> index = FindIndex(m_OldData, m_OldControl, m_OldCapacity, key, hash); index.IsValid())
+				return &m_OldData.Data[index.Value()];
+
+			return nullptr;
+		}
+
+		template <typename TLookup>
+		NODISCARD static Optional<size_t> FindIndex(const Memory<Node>& data, const i8* control, const size_t capacity,
+		                                            const TLookup& key, const size_t hash) noexcept
+		{
+			if (capacity == 0)
+				return Optional<size_t>::Empty();
+
+			const i8 h2 = Internal::H2(hash);
+			Internal::ProbeSequence probe(Internal::H1(hash), capacity / Internal::GroupWidth - 1);
+			while (true)
+			{
+				const size_t offset = probe.Offset();
+				const Internal::ControlGroup group(control + offset);
+
+				// Only nodes whose control byte matches H2 are compared
+				for (u32 mask = group.Match(h2); mask != 0; mask &= mask - 1)
 				{
-					m_Data[i] = data[i];
-					
-					// Update meta data
+					const size_t index = offset + std::countr_zero(mask);
+					if (data[index].GetKey() == key)
+						return Optional<size_t>(index);
 				}
+
+				// An empty slot ends the probe sequence
+				if (group.MatchEmpty() != 0)
+					return Optional<size_t>::Empty();
+
+				probe.Next();
 			}
+		}
+
+		NODISCARD bool HasKey(const KeyType& key, const size_t hash) const noexcept
+		{
+			return FindIndex(m_Data, m_Control, m_Capacity, key, hash).IsValid() ||
+				FindIndex(m_OldData, m_OldControl, m_OldCapacity, key, hash).IsValid();
+		}
 
-			//auto metaData = other.m_MetaData;
-			//while (metaData != nullptr)
-			//{
-			//	auto node = metaData->BucketReference;
-			//	while (node != nullptr)
-			//	{
-			//		Insert(node->Value);
-			//		node = node->Next;
-			//	}
-
-			//	metaData = metaData->Next;
-			//}
-		}
-
-		//bool Insert(const T& key)
-		//{
-		//	// Reallocate if necessary
-		//	if (!IsWithinThreshold())
-		//		Reallocate(m_Capacity * 2);
-
-		//	// Get hash value
-		//	const size_t hash = Hash(key) % m_Capacity;
-		//	++m_Size;
-
-		//	// Check if bucket is valid
-		//	auto bucket = &m_Data[hash];
-		//	if (bucket->IsValid())
-		//	{
-		//		// Get to the end of the chain (check for existing value)
-		//		auto node = bucket;
-		//		while (node->Next != nullptr)
-		//		{
-		//			if (node->GetKey() == key)
-		//				return false;
-
-		//			node = node->Next;
-		//		}
-
-		//		// Create new node
-		//		auto newNode = Alloc<Node>(1);
-		//		new(newNode) Node(key);
-
-		//		node->Next = newNode;
-		//		return true;
-		//	}
-
-		//	// Emplace value
-		//	new(&m_Data[hash]) Node(key);
-		//	AddMetaData(&m_Data[hash], hash);
-		//	return true;
-		//}
-
-		//bool Insert(KeyType&& key)
-		//{
-		//	// Reallocate if necessary
-		//	if (!IsWithinThreshold())
-		//		Reallocate(m_Capacity * 2);
-
-		//	// Get hash value
-		//	const size_t hash = Hash(key) % m_Capacity;
-		//	++m_Size;
-
-		//	// Check if bucket is valid
-		//	auto bucket = &m_Data[hash];
-		//	if (bucket->IsValid())
-		//	{
-		//		// Get to the end of the chain (check for existing value)
-		//		auto node = bucket;
-		//		while (node->Next != nullptr)
-		//		{
-		//			if (node->GetKey() == key)
-		//				return false;
-
-		//			node = node->Next;
-		//		}
-
-		//		// Create new node
-		//		auto newNode = Alloc<Node>(1);
-		//		new(newNode) Node(std::move(key));
-
-		//		node->Next = newNode;
-		//		return true;
-		//	}
-
-		//	// Emplace value
-		//	new(&m_Data[hash]) Node(std::move(key));
-		//	AddMetaData(&m_Data[hash], hash);
-		//	return true;
-		//}
-
-		//bool Insert(const KeyValuePair& tuple)
-		//{
-		//	// Reallocate if necessary
-		//	if (!IsWithinThreshold())
-		//		Reallocate(m_Capacity * 2);
-
-		//	// Get hash value
-		//	const size_t hash = Hash(tuple.Component1) % m_Capacity;
-		//	++m_Size;
-
-		//	// Check if bucket is valid
-		//	auto bucket = &m_Data[hash];
-		//	if (bucket->IsValid())
-		//	{
-		//		// Get to the end of the chain (check for existing value)
-		//		auto node = bucket;
-		//		while (node->Next != nullptr)
-		//		{
-		//			if (node->GetKey() == tuple.Component1)
-		//				return false;
-
-		//			node = node->Next;
-		//		}
-
-		//		// Create new node
-		//		auto newNode = Alloc<Node>(1);
-		//		new(newNode) Node(tuple);
-
-		//		node->Next = newNode;
-		//		return true;
-		//	}
-
-		//	// Emplace value
-		//	new(&m_Data[hash]) Node(tuple);
-		//	AddMetaData(&m_Data[hash], hash);
-		//	return true;
-		//}
-
-		//bool Insert(KeyValuePair&& tuple)
-		//{
-		//	// Reallocate if necessary
-		//	if (!IsWithinThreshold())
-		//		Reallocate(m_Capacity * 2);
-
-		//	// Get hash value
-		//	const size_t hash = Hash(tuple.Component1) % m_Capacity;
-		//	++m_Size;
-
-		//	// Check if bucket is valid
-		//	auto bucket = &m_Data[hash];
-		//	if (bucket->IsValid())
-		//	{
-		//		// Get to the end of the chain (check for existing value)
-		//		auto node = bucket;
-		//		while (node->Next != nullptr)
-		//		{
-		//			if (node->GetKey() == tuple.Component1)
-		//				return false;
-
-		//			node = node->Next;
-		//		}
-
-		//		// Create new node
-		//		auto newNode = Alloc<Node>(1);
-		//		new(newNode) Node(std::move(tuple));
-
-		//		node->Next = newNode;
-		//		return true;
-		//	}
-
-		//	// Emplace value
-		//	new(&m_Data[hash]) Node(std::move(tuple));
-		//	AddMetaData(&m_Data[hash], hash);
-		//	return true;
-		//}
-
-		//bool Erase(const KeyType& key)
-		//{
-		//	// Get hash value
-		//	const size_t hash = Hash(key) % m_Capacity;
-
-		//	// Check if bucket is valid
-		//	auto bucket = &m_Data[hash];
-		//	if (bucket->IsValid())
-		//	{
-		//		// Search for node with existing value
-		//		if (bucket->GetKey() == key)
-		//		{
-		//			// Dispose and shift nodes down (if applicable)
-		//			bucket->Dispose();
-
-		//			if (bucket->Next != nullptr)
-		//			{
-		//				auto prev = bucket;
-		//				auto node = prev->Next;
-		//				while (node->Next != nullptr)
-		//				{
-		//					prev->Value = std::move(node->Value);
-
-		//					prev = node;
-		//					node = node->Next;
-		//				}
-
-		//				// Clean up tail references
-		//				prev->Next = nullptr;
-		//				delete node;
-		//			}
-
-		//			RemoveMetaData(bucket);
-
-		//			--m_Size;
-		//			return true;
-		//		}
-
-		//		auto node = bucket;
-		//		while (node->Next != nullptr)
-		//		{
-		//			auto next = node->Next;
-		//			if (next->GetKey() == key)
-		//			{
-		//				// Move next pointer
-		//				node->Next = next->Next;
-
-		//				// Remove node
-		//				next->Invalidate();
-
-		//				delete next;
-
-		//				--m_Size;
-		//				return true;
-		//			}
-
-		//			node = next;
-		//		}
-		//	}
-
-		//	return false;
-		//}
-
-		//bool Erase(const KeyValuePair& tuple)
-		//{
-		//	// Get hash value
-		//	const size_t hash = Hash(tuple.Component1) % m_Capacity;
-
-		//	// Check if bucket is valid
-		//	auto bucket = &m_Data[hash];
-		//	if (bucket->IsValid())
-		//	{
-		//		// Search for node with existing value
-		//		if (bucket->GetKey() == tuple.Component1)
-		//		{
-		//			// Dispose and shift nodes down (if applicable)
-		//			bucket->Dispose();
-
-		//			if (bucket->Next != nullptr)
-		//			{
-		//				auto prev = bucket;
-		//				auto node = prev->Next;
-		//				while (node->Next != nullptr)
-		//				{
-		//					prev->Value = std::move(node->Value);
-
-		//					prev = node;
-		//					node = node->Next;
-		//				}
-
-		//				// Clean up tail references
-		//				prev->Next = nullptr;
-		//				delete node;
-		//			}
-
-		//			RemoveMetaData(bucket);
-
-		//			--m_Size;
-		//			return true;
-		//		}
-
-		//		auto node = bucket;
-		//		while (node->Next != nullptr)
-		//		{
-		//			auto next = node->Next;
-		//			if (next->GetKey() == tuple.Component1)
-		//			{
-		//				// Move next pointer
-		//				node->Next = next->Next;
-
-		//				// Remove node
-		//				next->Invalidate();
-
-		//				delete next;
-
-		//				--m_Size;
-		//				return true;
-		//			}
-
-		//			node = next;
-		//		}
-		//	}
-
-		//	return false;
-		//}
+		/// <summary>
+		/// Smallest capacity that holds the given number of elements within the load factor.
+		/// </summary>
+		NODISCARD constexpr size_t CapacityFor(const size_t count) const noexcept
+		{
+			return Internal::NormalizeCapacity(static_cast<size_t>(static_cast<double_t>(count) / m_LoadFactor) + 1);
+		}
 
-		NODISCARD constexpr bool IsWithinThreshold() const noexcept
+		/// <summary>
+		/// Frees the slot at the given index. A group that still has an empty slot never overflowed, so no
+		/// probe sequence passes through it and the slot can become empty again; otherwise it becomes deleted.
+		/// </summary>
+		/// <returns>True if the slot was marked as deleted</returns>
+		NODISCARD static bool MarkErased(i8* control, const size_t index) noexcept
 		{
-			return (static_cast<double_t>(m_Size) / static_cast<double_t>(m_Capacity)) < m_LoadFactor;
+			const size_t offset = index - index % Internal::GroupWidth;
+			if (Internal::ControlGroup(control + offset).MatchEmpty() != 0)
+			{
+				control[index] = Internal::EmptyControl;
+				return false;
+			}
+
+			control[index] = Internal::DeletedControl;
+			return true;
 		}
 
-		void AddMetaData(Node* node, const size_t hash)
+		template <typename TValue>
+		bool InsertUnique(const KeyType& key, const size_t hash, TValue&& value) noexcept
 		{
-			Allocator::AddMetaData(m_MetaData, node, hash);
+			if (HasKey(key, hash))
+				return false;
+
+			PrepareInsert();
+			Emplace(hash, std::forward<TValue>(value), m_Size - m_OldSize);
+			++m_Size;
+			return true;
 		}
 
-		void RemoveMetaData(Node* node)
+		/// <summary>
+		/// Makes room for one more node in the current block.
+		/// </summary>
+		void PrepareInsert() noexcept
 		{
-			Allocator::RemoveMetaData(m_MetaData, node);
+			// Grow, or purge deleted slots when they make up most of the load
+			if (m_Capacity == 0)
+				Allocate(DefaultCapacity);
+			else if (!IsWithinThreshold())
+			{
+				const size_t capacity = m_Size * 2 < m_Capacity ? m_Capacity : m_Capacity * 2;
+				if (m_IncrementalRehash)
+					BeginRehash(capacity);
+				else
+					Reallocate(capacity);
+			}
+
+			if (IsRehashing())
+				RehashStep();
+		}
+
+		/// <summary>
+		/// Constructs a node in the first free slot of the current block and registers it at the given
+		/// occupancy position. Doesn't touch the size.
+		/// </summary>
+		/// <returns>The new node</returns>
+		template <typename TValue>
+		Node& Emplace(const size_t hash, TValue&& value, const size_t position) noexcept
+		{
+			const size_t index = Internal::FindFirstNonFull(m_Control, m_Capacity, hash);
+			if (m_Control[index] == Internal::DeletedControl)
+				--m_Deleted;
+
+			new(&m_Data[index]) Node(std::forward<TValue>(value));
+			m_Control[index] = Internal::H2(hash);
+			m_Occupancy.Add(index, position);
+			return m_Data[index];
+		}
+
+		/* Incremental Rehashing */
+
+		/// <summary>
+		/// Swaps in a new, empty block of the given capacity and keeps the current one as the migration source.
+		/// </summary>
+		void BeginRehash(const size_t capacity) noexcept
+		{
+			// Only one migration can be in flight
+			RehashStep(m_OldSize);
+
+			m_OldData = m_Data;
+			m_OldControl = m_Control;
+			m_OldOccupancy = m_Occupancy;
+			m_OldSize = m_Size;
+			m_OldCapacity = m_Capacity;
+
+			m_Data = nullptr;
+			m_Control = nullptr;
+			m_Occupancy = Internal::OccupancyIndex{};
+			m_Capacity = 0;
+			m_Deleted = 0;
+			Allocate(capacity);
+		}
+
+		/// <summary>
+		/// Moves up to 'count' nodes from the old block into the current one, and frees the old block once empty.
+		/// </summary>
+		void RehashStep(size_t count = RehashStepSize) noexcept
+		{
+			for (; count > 0 && m_OldSize > 0; count--)
+			{
+				// Taking the last occupancy entry keeps the old index dense without any swapping
+				const size_t slot = m_OldOccupancy[m_OldSize - 1];
+				Node& node = m_OldData[slot];
+
+				Emplace(HashOf(node.GetKey()), std::move(node), m_Size - m_OldSize);
+				node.~Node();
+
+				// Deleted (not empty), so probe sequences that passed through this slot stay intact
+				m_OldControl[slot] = Internal::DeletedControl;
+				--m_OldSize;
+			}
+
+			if (m_OldSize == 0)
+				DisposeOld();
+		}
+
+		constexpr void DisposeOld() noexcept
+		{
+			Allocator::Dispose(m_OldData, m_OldControl, m_OldOccupancy, m_OldCapacity);
+			ForgetOld();
+		}
+
+		constexpr void ForgetOld() noexcept
+		{
+			m_OldData = nullptr;
+			m_OldControl = nullptr;
+			m_OldOccupancy = Internal::OccupancyIndex{};
+			m_OldSize = 0;
+			m_OldCapacity = 0;
 		}
 
 	protected:
-		Memory m_Data = nullptr;
-		MetaData* m_MetaData = nullptr;
+		Memory<Node> m_Data = nullptr;
+		i8* m_Control = nullptr;
+		Internal::OccupancyIndex m_Occupancy;
 		size_t m_Size = 0;
+		size_t m_Deleted = 0;
 		size_t m_Capacity = 0;
-		double_t m_LoadFactor = 0.80;
+		double_t m_LoadFactor = 0.875;
+
+	private:
+		// Block being drained by an incremental rehash (empty otherwise). 'm_Size' counts its nodes too.
+		Memory<Node> m_OldData = nullptr;
+		i8* m_OldControl = nullptr;
+		Internal::OccupancyIndex m_OldOccupancy;
+		size_t m_OldSize = 0;
+		size_t m_OldCapacity = 0;
+		bool m_IncrementalRehash = false;
 
 	private:
-		constexpr static size_t DefaultCapacity = 25;
+		constexpr static size_t DefaultCapacity = Internal::GroupWidth;
+		constexpr static size_t RehashStepSize = Internal::GroupWidth;
+		constexpr static double_t MinLoadFactor = 0.25;
+		constexpr static double_t MaxLoadFactor = 0.9375;
 	};
 }
@@ -1,50 +1,191 @@
 #pragma once
+#include <bit>
+
 #include "Core/Core.hpp"
+#include "Core/Typedef.hpp"
 #include "Core/Memory/Memory.hpp"
 
+#if SSE2_SUPPORTED
+#include <emmintrin.h>
+#endif
+
 namespace Micro::Internal
 {
-	// HashTable internal
-	template <typename TNode>
-	struct MetaData final
+	/// <summary>
+	/// Dense list of occupied slot indices plus the reverse map from slot to list position. Registration
+	/// appends and removal swaps the last entry into the hole, so both are O(1), and iterating the table
+	/// walks one contiguous array instead of scanning every slot.
+	/// </summary>
+	struct OccupancyIndex final
+	{
+		size_t* Slots = nullptr;
+		size_t* Positions = nullptr;
+
+		constexpr void Add(const size_t slot, const size_t position) noexcept
+		{
+			Slots[position] = slot;
+			Positions[slot] = position;
+		}
+
+		constexpr void Remove(const size_t slot, const size_t lastPosition) noexcept
+		{
+			const size_t position = Positions[slot];
+			const size_t last = Slots[lastPosition];
+			Slots[position] = last;
+			Positions[last] = position;
+		}
+
+		NODISCARD constexpr size_t operator[](const size_t position) const noexcept { return Slots[position]; }
+	};
+
+
+	/*
+	 *  ============================================================
+	 *	|                      Control Bytes                       |
+	 *  ============================================================
+	 */
+
+
+	// Every slot owns one control byte. Full slots store the low 7 bits of the hash (H2), so the sign bit
+	// alone tells full slots apart from empty and deleted ones.
+	constexpr i8 EmptyControl = -128;
+	constexpr i8 DeletedControl = -2;
+
+	// Number of control bytes probed at once
+	constexpr size_t GroupWidth = 16;
+
+	/// <summary>
+	/// Spreads the entropy of the given hash over all 64 bits, so both the probe position (H1) and the
+	/// control tag (H2) stay well distributed for weak hashes.
+	/// </summary>
+	NODISCARD constexpr size_t MixHash(const size_t hash) noexcept
 	{
-		// Aliases
-		using Node = TNode;
-		using ValueType = typename Node::ValueType;
-		using KeyType = typename Node::KeyType;
-		using IteratorType = typename Node::IteratorType;
+		const u64 mixed = static_cast<u64>(hash) * 0x9E3779B97F4A7C15ull;
+		return static_cast<size_t>(mixed ^ (mixed >> 32));
+	}
 
-		// Fields
-		MetaData* Next = nullptr;
-		Node* BucketReference = nullptr;
-		size_t Index = 0;
-		MemStatus Status = MemStatus::Invalid;
+	NODISCARD constexpr size_t H1(const size_t hash) noexcept { return hash >> 7; }
+	NODISCARD constexpr i8 H2(const size_t hash) noexcept { return static_cast<i8>(hash & 0x7F); }
+	NODISCARD constexpr bool IsFull(const i8 control) noexcept { return control >= 0; }
 
-		constexpr MetaData(Node* ptr, const size_t index) noexcept
-			: Next(nullptr), BucketReference(ptr), Index(index), Status(MemStatus::Valid)
+	/// <summary>
+	/// Represents a group of control bytes that are matched all at once (SSE2 when available, otherwise scalar).
+	/// Each match returns a bit mask where bit 'i' is set if the 'i'th control byte matched.
+	/// </summary>
+	class ControlGroup final
+	{
+	public:
+#if SSE2_SUPPORTED
+		explicit ControlGroup(const i8* control) noexcept
+			: m_Control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control)))
 		{
 		}
 
-		constexpr void Invalidate() noexcept
+		NODISCARD u32 Match(const i8 h2) const noexcept
 		{
-			Next = nullptr;
-			BucketReference->Invalidate();
-			BucketReference = nullptr;
-			Index = 0;
-			Status = MemStatus::Invalid;
+			return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_Control)));
 		}
 
-		NODISCARD constexpr bool IsValid() const { return Status == MemStatus::Valid; }
+		NODISCARD u32 MatchEmpty() const noexcept { return Match(EmptyControl); }
+
+		NODISCARD u32 MatchEmptyOrDeleted() const noexcept
+		{
+			// Empty (-128) and deleted (-2) are the only states below -1
+			return static_cast<u32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), m_Control)));
+		}
+
+		NODISCARD u32 MatchFull() const noexcept
+		{
+			return ~static_cast<u32>(_mm_movemask_epi8(m_Control)) & 0xFFFF;
+		}
+
+	private:
+		__m128i m_Control;
+#else
+		explicit constexpr ControlGroup(const i8* control) noexcept
+		{
+			for (size_t i = 0; i < GroupWidth; i++)
+				m_Control[i] = control[i];
+		}
+
+		NODISCARD constexpr u32 Match(const i8 h2) const noexcept
+		{
+			u32 mask = 0;
+			for (size_t i = 0; i < GroupWidth; i++)
+				mask |= static_cast<u32>(m_Control[i] == h2) << i;
+			return mask;
+		}
+
+		NODISCARD constexpr u32 MatchEmpty() const noexcept { return Match(EmptyControl); }
+
+		NODISCARD constexpr u32 MatchEmptyOrDeleted() const noexcept
+		{
+			u32 mask = 0;
+			for (size_t i = 0; i < GroupWidth; i++)
+				mask |= static_cast<u32>(m_Control[i] < -1) << i;
+			return mask;
+		}
+
+		NODISCARD constexpr u32 MatchFull() const noexcept
+		{
+			u32 mask = 0;
+			for (size_t i = 0; i < GroupWidth; i++)
+				mask |= static_cast<u32>(IsFull(m_Control[i])) << i;
+			return mask;
+		}
+
+	private:
+		i8 m_Control[GroupWidth]{};
+#endif
 	};
 
-	// HashTable internal
-	template <typename T>
-	struct HashNode final
+	/// <summary>
+	/// Triangular probe over group-aligned offsets. With a power-of-two group count every group is visited
+	/// exactly once before the sequence repeats.
+	/// </summary>
+	class ProbeSequence final
 	{
-		T Value;
-		HashNode* Next = nullptr;
-		MemStatus Status = MemStatus::Invalid;
+	public:
+		constexpr ProbeSequence(const size_t hash, const size_t groupMask) noexcept
+			: m_Group(hash & groupMask), m_GroupMask(groupMask)
+		{
+		}
+
+		NODISCARD constexpr size_t Offset() const noexcept { return m_Group * GroupWidth; }
+
+		constexpr void Next() noexcept
+		{
+			++m_Stride;
+			m_Group = (m_Group + m_Stride) & m_GroupMask;
+		}
 
-		NODISCARD constexpr bool IsValid() const noexcept { return Status == MemStatus::Valid; }
+	private:
+		size_t m_Group;
+		size_t m_GroupMask;
+		size_t m_Stride = 0;
 	};
+
+	/// <summary>
+	/// Rounds the capacity up to a power-of-two number of groups.
+	/// </summary>
+	NODISCARD constexpr size_t NormalizeCapacity(const size_t capacity) noexcept
+	{
+		return capacity <= GroupWidth ? GroupWidth : std::bit_ceil(capacity);
+	}
+
+	/// <summary>
+	/// Finds the first empty or deleted slot along the probe sequence of the hash.
+	/// </summary>
+	NODISCARD inline size_t FindFirstNonFull(const i8* control, const size_t capacity, const size_t hash) noexcept
+	{
+		ProbeSequence probe(H1(hash), capacity / GroupWidth - 1);
+		while (true)
+		{
+			const size_t offset = probe.Offset();
+			if (const u32 mask = ControlGroup(control + offset).MatchEmptyOrDeleted(); mask != 0)
+				return offset + std::countr_zero(mask);
+
+			probe.Next();
+		}
+	}
 }
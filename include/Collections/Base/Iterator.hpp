@@ -213,67 +213,4 @@ namespace Micro
 	private:
 		Node* m_Node = nullptr;
 	};
-
-	template <typename TMetaData>
-	class HashIterator final
-	{
-	public:
-		// Aliases
-		using MetaData = TMetaData;
-		using IteratorType = typename MetaData::IteratorType;
-
-		explicit constexpr HashIterator(MetaData* ptr) noexcept
-			: m_Node(ptr)
-		{
-		}
-
-		constexpr HashIterator& operator++() noexcept
-		{
-			m_Node = m_Node->Next;
-			return *this;
-		}
-
-		constexpr HashIterator operator++(int) noexcept
-		{
-			SegmentedIterator iterator = *this;
-			++*this;
-			return *this;
-		}
-
-		constexpr HashIterator& operator++() const noexcept
-		{
-			m_Node = m_Node->Next;
-			return *this;
-		}
-
-		constexpr HashIterator operator++(int) const noexcept
-		{
-			SegmentedIterator iterator = *this;
-			++*this;
-			return *this;
-		}
-
-		constexpr IteratorType* operator->() noexcept
-		{
-			return &m_Node->BucketReference->GetIteratorValue();
-		}
-
-		constexpr IteratorType& operator*() noexcept
-		{
-			return m_Node->BucketReference->GetIteratorValue();
-		}
-
-		NODISCARD constexpr bool operator==(const HashIterator& other) const noexcept
-		{
-			return m_Node == other.m_Node;
-		}
-
-		NODISCARD constexpr bool operator!=(const HashIterator& other) const noexcept
-		{
-			return !(*this == other);
-		}
-
-	private:
-		MetaData* m_Node = nullptr;
-	};
 }
@@ -2,6 +2,7 @@
 #include "Iterator.hpp"
 #include "Core/Core.hpp"
 
+#include "Core/Memory/Pool.hpp"
 #include "Core/Errors/Error.hpp"
 
 namespace Micro
@@ -30,7 +31,7 @@ namespace Micro
 		}
 
 		NodeChain(NodeChain&& other) noexcept
-			: m_Head(other.m_Head), m_Tail(other.m_Tail), m_Size(other.m_Size)
+			: m_Head(other.m_Head), m_Tail(other.m_Tail), m_Size(other.m_Size), m_Pool(std::move(other.m_Pool))
 		{
 			other.m_Head = nullptr;
 			other.m_Tail = nullptr;
@@ -94,7 +95,7 @@ namespace Micro
 		virtual void Clear()
 		{
 			// Invalidate data
-			Allocator::Dispose(m_Head);
+			Allocator::Dispose(m_Pool, m_Head);
 			m_Head = nullptr;
 			m_Tail = nullptr;
 			m_Size = 0;
@@ -148,6 +149,10 @@ namespace Micro
 			if (this == &other)
 				return *this;
 
+			// The nodes live in the other pool, so it comes along with them
+			Clear();
+			m_Pool = std::move(other.m_Pool);
+
 			m_Head = other.m_Head;
 			m_Tail = other.m_Tail;
 			m_Size = other.m_Size;
@@ -179,12 +184,12 @@ namespace Micro
 	protected:
 		void Allocate(const size_t capacity) noexcept
 		{
-			m_Size = Allocator::Allocate(m_Head, capacity);
+			m_Size = Allocator::Allocate(m_Pool, m_Head, capacity);
 		}
 
 		void Reallocate(const size_t capacity) noexcept
 		{
-			m_Size = Allocator::Reallocate(m_Head, m_Tail, m_Size, capacity);
+			m_Size = Allocator::Reallocate(m_Pool, m_Head, m_Tail, m_Size, capacity);
 		}
 
 		void CopyFrom(const NodeChain& other)
@@ -207,18 +212,23 @@ namespace Micro
 			return Allocator::IsNodeValid(node);
 		}
 
-		NODISCARD constexpr static Node* CreateEmptyNode() noexcept
+		NODISCARD Node* CreateEmptyNode() noexcept
 		{
-			auto node = Alloc<Node>(1);
+			auto node = m_Pool.Allocate();
 			node->Status = MemStatus::Invalid;
 			return node;
 		}
 
-		constexpr static void AssignNode(Node*& node, const T& value) noexcept
+		void DestroyNode(Node* node) noexcept
+		{
+			Allocator::DestroyNode(m_Pool, node);
+		}
+
+		void AssignNode(Node*& node, const T& value) noexcept
 		{
 			if (node == nullptr)
 			{
-				node = Alloc<Node>(1);
+				node = m_Pool.Allocate();
 				new(node) Node(value);
 				return;
 			}
@@ -227,11 +237,11 @@ namespace Micro
 			node->Status = MemStatus::Valid;
 		}
 
-		constexpr static void AssignNode(Node*& node, T&& value) noexcept
+		void AssignNode(Node*& node, T&& value) noexcept
 		{
 			if (node == nullptr)
 			{
-				node = Alloc<Node>(1);
+				node = m_Pool.Allocate();
 				new(node) Node(std::move(value));
 				return;
 			}
@@ -244,5 +254,8 @@ namespace Micro
 		Node* m_Head = nullptr;
 		Node* m_Tail = nullptr;
 		size_t m_Size = 0;
+
+		// Owns every node of the chain; removed nodes are recycled by later insertions
+		Pool<Node> m_Pool;
 	};
 }
@@ -0,0 +1,339 @@
+#pragma once
+#include <bit>
+#include <mutex>
+#include <shared_mutex>
+
+#include "Core/Core.hpp"
+#include "Core/Function.hpp"
+#include "Collections/Map.hpp"
+
+namespace Micro
+{
+	namespace Internal
+	{
+		/// <summary>
+		/// Hash table of a single ConcurrentMap shard. Exposes the node-level HashTable operations, which the map
+		/// only calls while holding the shard's lock.
+		/// </summary>
+		template <typename TKey, typename TValue>
+		class ConcurrentShardTable final : public HashTable<MapNode<TKey, TValue>>
+		{
+		public:
+			using Base = HashTable<MapNode<TKey, TValue>>;
+
+			using Base::HashOf;
+			using Base::FindNode;
+			using Base::Insert;
+			using Base::Erase;
+		};
+
+		/// <summary>
+		/// One independently locked stripe of a ConcurrentMap. Aligned so the locks of neighbouring shards never
+		/// share a cache line.
+		/// </summary>
+		template <typename TKey, typename TValue>
+		struct alignas(CACHE_LINE_SIZE) ConcurrentShard final
+		{
+			mutable std::shared_mutex Lock;
+			ConcurrentShardTable<TKey, TValue> Table;
+		};
+	}
+
+	/**
+	 * \brief Thread-safe hash map striped into independently locked shards. Each key belongs to exactly one shard,
+	 *		  so operations on different shards never contend, and lookups only take their shard's lock shared.
+	 *		  Values are returned by copy, since a reference would outlive the lock that protects it.
+	 * \tparam TKey Key type
+	 * \tparam TValue Value type
+	 * \tparam TShardCount Number of shards (power of two)
+	 */
+	template <Hashable TKey, typename TValue, size_t TShardCount = 64>
+	class ConcurrentMap final
+	{
+		static_assert(std::has_single_bit(TShardCount), "Shard count must be a power of two.");
+
+	public:
+		/*
+		 *  ============================================================
+		 *	|                          Aliases                         |
+		 *  ============================================================
+		 */
+
+
+		using KeyValuePair = Tuple<TKey, TValue>;
+		using Shard = Internal::ConcurrentShard<TKey, TValue>;
+		using ShardTable = Internal::ConcurrentShardTable<TKey, TValue>;
+
+
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		ConcurrentMap() noexcept = default;
+
+		// Shards own their locks, which can't be copied or moved
+		ConcurrentMap(const ConcurrentMap&) = delete;
+		ConcurrentMap(ConcurrentMap&&) = delete;
+
+		~ConcurrentMap() noexcept = default;
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Utility                          |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Adds the pair if the key doesn't exist yet.
+		/// </summary>
+		/// <returns>True, if added</returns>
+		bool TryAdd(const TKey& key, const TValue& value) noexcept
+		{
+			const size_t hash = ShardTable::HashOf(key);
+			Shard& shard = m_Shards[ShardIndex(hash)];
+			std::unique_lock lock(shard.Lock);
+			return shard.Table.Insert(KeyValuePair{ key, value }, hash);
+		}
+
+		/// <summary>
+		/// Adds the pair, or overwrites the value if the key already exists.
+		/// </summary>
+		/// <returns>True if the pair was added, false if an existing value was replaced</returns>
+		bool AddOrUpdate(const TKey& key, const TValue& value) noexcept
+		{
+			const size_t hash = ShardTable::HashOf(key);
+			Shard& shard = m_Shards[ShardIndex(hash)];
+			std::unique_lock lock(shard.Lock);
+
+			if (auto* node = shard.Table.FindNode(key, hash))
+			{
+				node->GetValue() = value;
+				return false;
+			}
+
+			return shard.Table.Insert(KeyValuePair{ key, value }, hash);
+		}
+
+		/// <summary>
+		/// Adds the pair, or replaces the existing value with the result of the update function. The update
+		/// function runs under the shard's lock, so it must not call back into the map.
+		/// </summary>
+		/// <param name="key">Key to add or update</param>
+		/// <param name="addValue">Value to add if the key doesn't exist</param>
+		/// <param name="updateFactory">Produces the new value from the key and the existing value</param>
+		/// <returns>The value now stored for the key</returns>
+		TValue AddOrUpdate(const TKey& key, const TValue& addValue, const Func<TValue, TKey, TValue>& updateFactory)
+		{
+			const size_t hash = ShardTable::HashOf(key);
+			Shard& shard = m_Shards[ShardIndex(hash)];
+			std::unique_lock lock(shard.Lock);
+
+			if (auto* node = shard.Table.FindNode(key, hash))
+			{
+				node->GetValue() = updateFactory(key, node->GetValue());
+				return node->GetValue();
+			}
+
+			(void)shard.Table.Insert(KeyValuePair{ key, addValue }, hash);
+			return addValue;
+		}
+
+		/// <summary>
+		/// Gets the value of the key, or adds the given value if the key doesn't exist. Hits only take the
+		/// shard's lock shared.
+		/// </summary>
+		/// <returns>The value stored for the key</returns>
+		TValue GetOrAdd(const TKey& key, const TValue& value) noexcept
+		{
+			const size_t hash = ShardTable::HashOf(key);
+			Shard& shard = m_Shards[ShardIndex(hash)];
+			{
+				std::shared_lock lock(shard.Lock);
+				if (const auto* node = shard.Table.FindNode(key, hash))
+					return node->GetValue();
+			}
+
+			std::unique_lock lock(shard.Lock);
+
+			// Another writer may have added the key between the two locks
+			if (const auto* node = shard.Table.FindNode(key, hash))
+				return node->GetValue();
+
+			(void)shard.Table.Insert(KeyValuePair{ key, value }, hash);
+			return value;
+		}
+
+		/// <summary>
+		/// Gets the value of the key, or adds the value produced by the factory if the key doesn't exist. The factory
+		/// runs under the shard's lock (so it runs at most once per key), and must not call back into the map.
+		/// </summary>
+		/// <returns>The value stored for the key</returns>
+		TValue GetOrAdd(const TKey& key, const Func<TValue, TKey>& valueFactory)
+		{
+			const size_t hash = ShardTable::HashOf(key);
+			Shard& shard = m_Shards[ShardIndex(hash)];
+			{
+				std::shared_lock lock(shard.Lock);
+				if (const auto* node = shard.Table.FindNode(key, hash))
+					return node->GetValue();
+			}
+
+			std::unique_lock lock(shard.Lock);
+			if (const auto* node = shard.Table.FindNode(key, hash))
+				return node->GetValue();
+
+			TValue value = valueFactory(key);
+			(void)shard.Table.Insert(KeyValuePair{ key, value }, hash);
+			return value;
+		}
+
+		bool Remove(const TKey& key) noexcept
+		{
+			const size_t hash = ShardTable::HashOf(key);
+			Shard& shard = m_Shards[ShardIndex(hash)];
+			std::unique_lock lock(shard.Lock);
+			return shard.Table.Erase(key, hash);
+		}
+
+		/// <summary>
+		/// Removes the key and hands out the value it had.
+		/// </summary>
+		/// <returns>True, if the key existed</returns>
+		bool TryRemove(const TKey& key, TValue& out) noexcept
+		{
+			const size_t hash = ShardTable::HashOf(key);
+			Shard& shard = m_Shards[ShardIndex(hash)];
+			std::unique_lock lock(shard.Lock);
+
+			auto* node = shard.Table.FindNode(key, hash);
+			if (node == nullptr)
+				return false;
+
+			out = std::move(node->GetValue());
+			return shard.Table.Erase(key, hash);
+		}
+
+		/// <summary>
+		/// Removes every pair. Shards are cleared one at a time, so concurrent writers may leave pairs behind.
+		/// </summary>
+		void Clear() noexcept
+		{
+			for (Shard& shard : m_Shards)
+			{
+				std::unique_lock lock(shard.Lock);
+				shard.Table.Clear();
+			}
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD bool TryGetValue(const TKey& key, TValue& out) const noexcept
+		{
+			return TryGet(key, out);
+		}
+
+		template <TransparentKey<TKey> TLookup>
+		NODISCARD bool TryGetValue(const TLookup& key, TValue& out) const noexcept
+		{
+			return TryGet(key, out);
+		}
+
+		NODISCARD bool ContainsKey(const TKey& key) const noexcept
+		{
+			const size_t hash = ShardTable::HashOf(key);
+			const Shard& shard = m_Shards[ShardIndex(hash)];
+			std::shared_lock lock(shard.Lock);
+			return shard.Table.FindNode(key, hash) != nullptr;
+		}
+
+		template <TransparentKey<TKey> TLookup>
+		NODISCARD bool ContainsKey(const TLookup& key) const noexcept
+		{
+			const size_t hash = ShardTable::HashOf(key);
+			const Shard& shard = m_Shards[ShardIndex(hash)];
+			std::shared_lock lock(shard.Lock);
+			return shard.Table.FindNode(key, hash) != nullptr;
+		}
+
+		/// <summary>
+		/// Counts the pairs of all shards. Only a snapshot while other threads keep writing.
+		/// </summary>
+		NODISCARD size_t Size() const noexcept
+		{
+			size_t size = 0;
+			for (const Shard& shard : m_Shards)
+			{
+				std::shared_lock lock(shard.Lock);
+				size += shard.Table.Size();
+			}
+
+			return size;
+		}
+
+		NODISCARD bool IsEmpty() const noexcept { return Size() == 0; }
+		NODISCARD constexpr static size_t ShardCount() noexcept { return TShardCount; }
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		ConcurrentMap& operator=(const ConcurrentMap&) = delete;
+		ConcurrentMap& operator=(ConcurrentMap&&) = delete;
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Picks the shard from the top bits of the table hash. Tables probe with the low bits of the same hash,
+		/// so the keys of one shard still spread over its whole table.
+		/// </summary>
+		NODISCARD constexpr static size_t ShardIndex(const size_t hash) noexcept
+		{
+			if constexpr (TShardCount == 1)
+				return 0;
+			else
+				return hash >> (sizeof(size_t) * 8 - ShardBits);
+		}
+
+		template <typename TLookup>
+		NODISCARD bool TryGet(const TLookup& key, TValue& out) const noexcept
+		{
+			const size_t hash = ShardTable::HashOf(key);
+			const Shard& shard = m_Shards[ShardIndex(hash)];
+			std::shared_lock lock(shard.Lock);
+
+			const auto* node = shard.Table.FindNode(key, hash);
+			if (node == nullptr)
+				return false;
+
+			out = node->GetValue();
+			return true;
+		}
+
+	private:
+		Shard m_Shards[TShardCount];
+
+	private:
+		constexpr static size_t ShardBits = std::countr_zero(TShardCount);
+	};
+}
@@ -0,0 +1,378 @@
+#pragma once
+#include <ostream>
+
+#include "Collections/Base/Enumerable.hpp"
+#include "Common/Span.hpp"
+#include "Core/Errors/Error.hpp"
+#include "Core/Function.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Utility/Options/Optional.hpp"
+#include "Utility/Options/Result.hpp"
+
+namespace Micro
+{
+	/**
+	 * \brief Bounded list stored entirely inside the object, which never allocates. Unlike Array, its storage starts
+	 *		  uninitialized: elements are constructed when added and destroyed when removed, and the size is tracked.
+	 *		  Adding past the capacity fails with a CapacityExceededError instead of growing. Errors of this class
+	 *		  carry no message, so no path (not even a failing one) reaches the heap.
+	 * \tparam T Type of elements in list
+	 * \tparam TCapacity Maximum number of elements
+	 */
+	template <typename T, size_t TCapacity>
+	class FixedList final : public Enumerable<T>
+	{
+		static_assert(TCapacity != 0, "Capacity must be greater than zero.");
+
+	public:
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		/**
+		 * \brief Initializes a new instance of the FixedList class without any elements.
+		 */
+		FixedList() noexcept = default;
+
+		/**
+		 * \brief Initializes a new instance of the FixedList class by copying the value of the given FixedList.
+		 * \param list FixedList to copy
+		 */
+		FixedList(const FixedList& list) noexcept { CopyFrom(list); }
+
+		/**
+		 * \brief Initializes a new instance of the FixedList class by moving the elements of the given FixedList.
+		 * \param list FixedList to move (left empty)
+		 */
+		FixedList(FixedList&& list) noexcept { MoveFrom(std::move(list)); }
+
+		/**
+		 * \brief Initializes a new instance of the FixedList class by moving the elements of the given initializer list.
+		 *		  Elements past the capacity are ignored.
+		 * \param initializerList Initializer list to move
+		 */
+		FixedList(std::initializer_list<T>&& initializerList) noexcept
+		{
+			for (auto& elem : initializerList)
+			{
+				if (m_Size == TCapacity)
+					return;
+
+				new(&Data()[m_Size++]) T(std::move(const_cast<T&>(elem)));
+			}
+		}
+
+		/**
+		 * \brief Destroys the elements.
+		 */
+		~FixedList() noexcept override { Clear(); }
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD constexpr bool IsEmpty() const noexcept { return m_Size == 0; }
+		NODISCARD constexpr bool IsFull() const noexcept { return m_Size == TCapacity; }
+		NODISCARD T* Data() noexcept { return m_Storage.Data(); }
+		NODISCARD const T* Data() const noexcept { return m_Storage.Data(); }
+		NODISCARD constexpr size_t Size() const noexcept { return m_Size; }
+		NODISCARD constexpr static size_t Capacity() noexcept { return TCapacity; }
+		NODISCARD Span<T> AsSpan() const noexcept { return { Data(), m_Size }; }
+
+		/* Enumerators (Iterators) */
+
+		NODISCARD Enumerator<T> GetEnumerator() override
+		{
+			for (size_t i = 0; i < m_Size; i++)
+			{
+				auto& element = Data()[i];
+				co_yield element;
+			}
+		}
+
+		NODISCARD Enumerator<T> GetEnumerator() const override
+		{
+			for (size_t i = 0; i < m_Size; i++)
+			{
+				const auto& element = Data()[i];
+				co_yield element;
+			}
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Utility                          |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Adds the given value to the list by copy.
+		/// </summary>
+		/// <param name="value">Value to add to list</param>
+		/// <returns>True, or a CapacityExceededError if the list is full</returns>
+		NODISCARD Result<bool> Add(const T& value) noexcept
+		{
+			if (IsFull())
+				return Result<bool>::CaptureError(CapacityExceededError());
+
+			new(&Data()[m_Size++]) T(value);
+			return Result<bool>::Ok(true);
+		}
+
+		/// <summary>
+		/// Adds the given value to the list by move.
+		/// </summary>
+		/// <param name="value">Value to add to list</param>
+		/// <returns>True, or a CapacityExceededError if the list is full</returns>
+		NODISCARD Result<bool> Add(T&& value) noexcept
+		{
+			if (IsFull())
+				return Result<bool>::CaptureError(CapacityExceededError());
+
+			new(&Data()[m_Size++]) T(std::move(value));
+			return Result<bool>::Ok(true);
+		}
+
+		/// <summary>
+		/// Uses the given arguments to create the value inside the list.
+		/// </summary>
+		/// <param name="args">Args to create value inside the list</param>
+		///	<returns>Reference to the newly created value, or a CapacityExceededError if the list is full</returns>
+		template <typename... Args>
+		NODISCARD Result<T&> Emplace(Args&&... args) noexcept
+		{
+			if (IsFull())
+				return Result<T&>::CaptureError(CapacityExceededError());
+
+			new(&Data()[m_Size]) T(std::forward<Args>(args)...);
+			return Result<T&>::Ok(Data()[m_Size++]);
+		}
+
+		/// <summary>
+		/// Adds all the elements from the given span to the list by copy. Nothing is added if they don't all fit.
+		/// </summary>
+		/// <param name="span">Span to add to the list</param>
+		/// <returns>True, or a CapacityExceededError if the elements don't fit</returns>
+		NODISCARD Result<bool> AddRange(const Span<T>& span) noexcept
+		{
+			const size_t size = span.Capacity();
+			if (size > TCapacity - m_Size)
+				return Result<bool>::CaptureError(CapacityExceededError());
+
+			for (size_t i = 0; i < size; i++)
+				new(&Data()[m_Size++]) T(span[i]);
+			return Result<bool>::Ok(true);
+		}
+
+		Result<bool> Insert(const size_t index, const T& value) noexcept
+		{
+			const auto result = InsertEmplace(index, value);
+			return result.IsValid() ? Result<bool>::Ok(true) : Result<bool>::CaptureError(result.ErrorHandle());
+		}
+
+		Result<bool> Insert(const size_t index, T&& value) noexcept
+		{
+			const auto result = InsertEmplace(index, std::move(value));
+			return result.IsValid() ? Result<bool>::Ok(true) : Result<bool>::CaptureError(result.ErrorHandle());
+		}
+
+		/// <summary>
+		/// Creates a value in front of the element at the given index (or at the end, if the index is the size).
+		/// </summary>
+		template <typename... Args>
+		Result<T&> InsertEmplace(const size_t index, Args&&... args) noexcept
+		{
+			if (index > m_Size)
+				return Result<T&>::CaptureError(Error(ErrorType::ArgumentOutOfRange));
+			if (IsFull())
+				return Result<T&>::CaptureError(CapacityExceededError());
+
+			// Created before shifting, since the arguments may refer to an element that is about to move
+			T value(std::forward<Args>(args)...);
+			ShiftRight(Data(), m_Size, index);
+
+			new(&Data()[index]) T(std::move(value));
+			++m_Size;
+			return Result<T&>::Ok(Data()[index]);
+		}
+
+		bool Remove(const T& value) noexcept
+		{
+			const auto result = IndexOf(value);
+			if (!result.IsValid())
+				return false;
+
+			return RemoveAt(result.Value()).IsValid();
+		}
+
+		Result<bool> RemoveAt(const size_t index) noexcept
+		{
+			if (index >= m_Size)
+				return Result<bool>::CaptureError(Error(ErrorType::ArgumentOutOfRange));
+
+			Data()[index].~T();
+			ShiftLeft(Data(), m_Size, index + 1);
+
+			--m_Size;
+			return Result<bool>::Ok(true);
+		}
+
+		Result<bool> RemoveRange(const size_t index, const size_t count) noexcept
+		{
+			const size_t length = index + count;
+			if (index >= m_Size || length > m_Size)
+				return Result<bool>::CaptureError(Error(ErrorType::ArgumentOutOfRange));
+
+			for (size_t i = index; i < length; i++)
+				Data()[i].~T();
+
+			ShiftLeft(Data(), m_Size, length, count);
+
+			m_Size -= count;
+			return Result<bool>::Ok(true);
+		}
+
+		size_t RemoveAll(const Predicate<T>& predicate) noexcept
+		{
+			// Survivors are compacted to the front in one pass
+			T* data = Data();
+			size_t length = 0;
+			for (size_t i = 0; i < m_Size; i++)
+			{
+				if (predicate(data[i]))
+				{
+					data[i].~T();
+					continue;
+				}
+
+				if (length != i)
+					Relocate(&data[i], 1, &data[length]);
+				++length;
+			}
+
+			const size_t count = m_Size - length;
+			m_Size = length;
+			return count;
+		}
+
+		void Clear() noexcept
+		{
+			for (size_t i = 0; i < m_Size; i++)
+				Data()[i].~T();
+			m_Size = 0;
+		}
+
+		NODISCARD bool Contains(const T& value) const noexcept { return Micro::Contains(AsSpan(), value); }
+
+		NODISCARD bool Equals(const FixedList& list) const noexcept { return Micro::Equals(AsSpan(), list.AsSpan()); }
+
+		NODISCARD Optional<size_t> IndexOf(const T& value) const noexcept { return Micro::IndexOf(AsSpan(), value); }
+
+		NODISCARD Optional<size_t> LastIndexOf(const T& value) const noexcept { return Micro::LastIndexOf(AsSpan(), value); }
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Gets the element at the given index, or an empty result if invalid.
+		/// </summary>
+		/// <param name="index">Index of element</param>
+		/// <returns>Reference to the element at index, or empty result if invalid</returns>
+		NODISCARD Result<T&> operator[](const size_t index) noexcept
+		{
+			if (index >= m_Size)
+				return Result<T&>::CaptureError(Error(ErrorType::IndexOfRange));
+
+			return Result<T&>::Ok(Data()[index]);
+		}
+
+		/// <summary>
+		/// Gets the element at the given index, or an empty result if invalid. (const version)
+		/// </summary>
+		/// <param name="index">Index of element</param>
+		/// <returns>Reference to the element at index, or empty result if invalid</returns>
+		NODISCARD Result<const T&> operator[](const size_t index) const noexcept
+		{
+			if (index >= m_Size)
+				return Result<const T&>::CaptureError(Error(ErrorType::IndexOfRange));
+
+			return Result<const T&>::Ok(Data()[index]);
+		}
+
+		NODISCARD explicit operator Span<T>() const noexcept { return AsSpan(); }
+
+		FixedList& operator=(const FixedList& list) noexcept
+		{
+			if (this == &list)
+				return *this;
+
+			Clear();
+			CopyFrom(list);
+			return *this;
+		}
+
+		FixedList& operator=(FixedList&& list) noexcept
+		{
+			if (this == &list)
+				return *this;
+
+			Clear();
+			MoveFrom(std::move(list));
+			return *this;
+		}
+
+		friend std::ostream& operator<<(std::ostream& stream, const FixedList& current) noexcept
+		{
+			stream << "[";
+			for (size_t i = 0; i < current.m_Size; i++)
+			{
+				stream << current.Data()[i];
+				if (i != current.m_Size - 1)
+					stream << ", ";
+			}
+
+			stream << "]";
+			return stream;
+		}
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		void CopyFrom(const FixedList& list) noexcept
+		{
+			for (size_t i = 0; i < list.m_Size; i++)
+				new(&Data()[i]) T(list.Data()[i]);
+			m_Size = list.m_Size;
+		}
+
+		void MoveFrom(FixedList&& list) noexcept
+		{
+			Relocate(list.Data(), list.m_Size, Data());
+			m_Size = list.m_Size;
+			list.m_Size = 0;
+		}
+
+	private:
+		UninitializedStorage<T, TCapacity> m_Storage;
+		size_t m_Size = 0;
+	};
+}
@@ -0,0 +1,551 @@
+#pragma once
+#include <algorithm>
+#include <concepts>
+
+#include "Utility/Tuple.hpp"
+#include "Core/Function.hpp"
+#include "Core/Hash.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Core/Memory/GrowthPolicy.hpp"
+#include "Core/Errors/Error.hpp"
+#include "Common/Span.hpp"
+#include "Collections/Base/Enumerable.hpp"
+#include "Utility/Options/Optional.hpp"
+
+namespace Micro
+{
+	/**
+	 * \brief Map stored as one contiguous block of key/value pairs, kept sorted by key. Lookups are a branchless
+	 *		  binary search, so small, read-mostly dictionaries need no buckets, control bytes or nodes. Adding or
+	 *		  removing a single pair shifts the pairs after it; bulk construction copies everything once and sorts.
+	 * \tparam TKey Key type (ordered with '<')
+	 * \tparam TValue Value type
+	 * \tparam TGrowth Policy picking the capacity to grow to when the block is full
+	 */
+	template <std::totally_ordered TKey, typename TValue, GrowthPolicy TGrowth = DoublingGrowth>
+	class FlatMap final : public Enumerable<Tuple<TKey, TValue>>
+	{
+	public:
+		/*
+		 *  ============================================================
+		 *	|                          Aliases                         |
+		 *  ============================================================
+		 */
+
+
+		using KeyValuePair = Tuple<TKey, TValue>;
+
+
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		constexpr FlatMap() noexcept = default;
+
+		constexpr FlatMap(const FlatMap& other) noexcept
+		{
+			if (other.m_Size == 0)
+				return;
+
+			Allocate(other.m_Size);
+			for (; m_Size < other.m_Size; m_Size++)
+				new(&m_Data[m_Size]) KeyValuePair(other.m_Data[m_Size]);
+		}
+
+		constexpr FlatMap(FlatMap&& other) noexcept
+			: m_Data(std::move(other.m_Data)), m_Size(other.m_Size), m_Capacity(other.m_Capacity)
+		{
+			other.m_Data = nullptr;
+			other.m_Size = 0;
+			other.m_Capacity = 0;
+		}
+
+		/// <summary>
+		/// Builds the map from unsorted pairs: copies them all, sorts once, then drops repeated keys (the first
+		/// occurrence wins, like repeated calls to 'Add').
+		/// </summary>
+		constexpr FlatMap(std::initializer_list<KeyValuePair>&& initializerList) noexcept
+		{
+			Build(initializerList.begin(), initializerList.size());
+		}
+
+		/// <summary>
+		/// Builds the map from unsorted pairs: copies them all, sorts once, then drops repeated keys (the first
+		/// occurrence wins, like repeated calls to 'Add').
+		/// </summary>
+		constexpr explicit FlatMap(const Span<KeyValuePair>& pairs) noexcept
+		{
+			Build(pairs.Data(), pairs.Capacity());
+		}
+
+		constexpr explicit FlatMap(const size_t capacity) noexcept { Allocate(capacity); }
+
+		constexpr ~FlatMap() noexcept override
+		{
+			Clear();
+			Dispose();
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Utility                          |
+		 *  ============================================================
+		 */
+
+
+		bool Add(const TKey& key, const TValue& value) noexcept
+		{
+			const Optional<size_t> index = InsertionIndex(key);
+			if (index.IsValid())
+				EmplaceAt(index.Value(), KeyValuePair{ key, value });
+
+			return index.IsValid();
+		}
+
+		bool Add(TKey&& key, TValue&& value) noexcept
+		{
+			const Optional<size_t> index = InsertionIndex(key);
+			if (index.IsValid())
+				EmplaceAt(index.Value(), KeyValuePair{ std::move(key), std::move(value) });
+
+			return index.IsValid();
+		}
+
+		bool Add(const KeyValuePair& pair) noexcept
+		{
+			const Optional<size_t> index = InsertionIndex(pair.Component1);
+			if (index.IsValid())
+				EmplaceAt(index.Value(), pair);
+
+			return index.IsValid();
+		}
+
+		bool Add(KeyValuePair&& pair) noexcept
+		{
+			const Optional<size_t> index = InsertionIndex(pair.Component1);
+			if (index.IsValid())
+				EmplaceAt(index.Value(), std::move(pair));
+
+			return index.IsValid();
+		}
+
+		/// <summary>
+		/// Adds a range of unsorted pairs: appends them, sorts only the appended run, and merges it into the
+		/// existing pairs. Keys that already exist (or repeat within the range) keep their first value.
+		/// </summary>
+		/// <param name="pairs">Pairs to add</param>
+		/// <returns>Number of pairs that were added</returns>
+		size_t AddRange(const Span<KeyValuePair>& pairs) noexcept
+		{
+			const size_t count = pairs.Capacity();
+			if (count == 0)
+				return 0;
+
+			Reserve(m_Size + count);
+
+			const size_t previousSize = m_Size;
+			for (size_t i = 0; i < count; i++)
+				new(&m_Data[m_Size++]) KeyValuePair(pairs[i]);
+
+			// Both sorts are stable, so existing pairs stay ahead of new pairs with the same key
+			KeyValuePair* data = m_Data.Data;
+			std::stable_sort(data + previousSize, data + m_Size, KeyLess);
+			std::inplace_merge(data, data + previousSize, data + m_Size, KeyLess);
+			RemoveRepeatedKeys();
+
+			return m_Size - previousSize;
+		}
+
+		bool Remove(const TKey& key) noexcept
+		{
+			const size_t index = LowerBound(key);
+			if (index >= m_Size || m_Data[index].Component1 != key)
+				return false;
+
+			m_Data[index].~KeyValuePair();
+			ShiftLeft(m_Data.Data, m_Size, index + 1);
+
+			--m_Size;
+			return true;
+		}
+
+		/// <summary>
+		/// Makes room for the given number of pairs. Never shrinks.
+		/// </summary>
+		constexpr void Reserve(const size_t capacity) noexcept
+		{
+			if (capacity > m_Capacity)
+				Reallocate(capacity);
+		}
+
+		/// <summary>
+		/// Reallocates the block to fit the pairs exactly, or frees it if the map is empty.
+		/// </summary>
+		constexpr void ShrinkToFit() noexcept
+		{
+			if (m_Size == 0)
+				Dispose();
+			else if (m_Capacity > m_Size)
+				Reallocate(m_Size);
+		}
+
+		constexpr void Clear() noexcept
+		{
+			for (size_t i = 0; i < m_Size; i++)
+				m_Data[i].~KeyValuePair();
+
+			m_Size = 0;
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD Optional<const TValue&> Find(const TKey& key) const noexcept
+		{
+			if (const KeyValuePair* pair = FindPair(key))
+				return Optional<const TValue&>(pair->Component2);
+
+			return Optional<const TValue&>::Empty();
+		}
+
+		NODISCARD Optional<TValue&> Find(const TKey& key) noexcept
+		{
+			if (KeyValuePair* pair = FindPair(key))
+				return Optional<TValue&>(pair->Component2);
+
+			return Optional<TValue&>::Empty();
+		}
+
+		/// <summary>
+		/// Finds the value whose key equals the lookup value (e.g. a StringBuffer or char pointer for String keys),
+		/// without converting the lookup value to a key. Keys must order against it like against another key.
+		/// </summary>
+		template <TransparentKey<TKey> TLookup>
+		NODISCARD Optional<const TValue&> Find(const TLookup& key) const noexcept
+		{
+			if (const KeyValuePair* pair = FindPair(key))
+				return Optional<const TValue&>(pair->Component2);
+
+			return Optional<const TValue&>::Empty();
+		}
+
+		template <TransparentKey<TKey> TLookup>
+		NODISCARD Optional<TValue&> Find(const TLookup& key) noexcept
+		{
+			if (KeyValuePair* pair = FindPair(key))
+				return Optional<TValue&>(pair->Component2);
+
+			return Optional<TValue&>::Empty();
+		}
+
+		NODISCARD Optional<KeyValuePair> Find(const Predicate<TKey>& predicate) const noexcept
+		{
+			for (size_t i = 0; i < m_Size; i++)
+			{
+				if (predicate(m_Data[i].Component1))
+					return Optional<KeyValuePair>(m_Data[i]);
+			}
+
+			return Optional<KeyValuePair>::Empty();
+		}
+
+		NODISCARD bool ContainsKey(const TKey& key) const noexcept
+		{
+			return FindPair(key) != nullptr;
+		}
+
+		template <TransparentKey<TKey> TLookup>
+		NODISCARD bool ContainsKey(const TLookup& key) const noexcept
+		{
+			return FindPair(key) != nullptr;
+		}
+
+		NODISCARD bool ContainsValue(const TValue& value) const noexcept
+		{
+			for (size_t i = 0; i < m_Size; i++)
+				if (m_Data[i].Component2 == value)
+					return true;
+
+			return false;
+		}
+
+		NODISCARD bool TryGetValue(const TKey& key, TValue& out) const noexcept
+		{
+			const KeyValuePair* pair = FindPair(key);
+			if (pair == nullptr)
+				return false;
+
+			out = pair->Component2;
+			return true;
+		}
+
+		template <TransparentKey<TKey> TLookup>
+		NODISCARD bool TryGetValue(const TLookup& key, TValue& out) const noexcept
+		{
+			const KeyValuePair* pair = FindPair(key);
+			if (pair == nullptr)
+				return false;
+
+			out = pair->Component2;
+			return true;
+		}
+
+		NODISCARD constexpr bool IsEmpty() const noexcept { return m_Size == 0; }
+		NODISCARD constexpr size_t Size() const noexcept { return m_Size; }
+		NODISCARD constexpr size_t Capacity() const noexcept { return m_Capacity; }
+
+		/// <summary>
+		/// Gets the pairs, sorted by key.
+		/// </summary>
+		NODISCARD constexpr Span<KeyValuePair> AsSpan() const noexcept { return { m_Data.Data, m_Size }; }
+
+		/* Enumerators (Iterators) */
+
+		NODISCARD Enumerator<KeyValuePair> GetEnumerator() override
+		{
+			for (size_t i = 0; i < m_Size; i++)
+			{
+				auto& element = m_Data[i];
+				co_yield element;
+			}
+		}
+
+		NODISCARD Enumerator<KeyValuePair> GetEnumerator() const override
+		{
+			for (size_t i = 0; i < m_Size; i++)
+			{
+				const auto& element = m_Data[i];
+				co_yield element;
+			}
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD const TValue& operator[](const TKey& key) const
+		{
+			if (const KeyValuePair* pair = FindPair(key))
+				return pair->Component2;
+
+			throw KeyNotFoundError("Key could not be found in the FlatMap.", NAMEOF(key));
+		}
+
+		NODISCARD TValue& operator[](const TKey& key)
+		{
+			if (KeyValuePair* pair = FindPair(key))
+				return pair->Component2;
+
+			throw KeyNotFoundError("Key could not be found in the FlatMap.", NAMEOF(key));
+		}
+
+		FlatMap& operator=(const FlatMap& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			Clear();
+			Reserve(other.m_Size);
+			for (; m_Size < other.m_Size; m_Size++)
+				new(&m_Data[m_Size]) KeyValuePair(other.m_Data[m_Size]);
+
+			return *this;
+		}
+
+		FlatMap& operator=(FlatMap&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			Clear();
+			Dispose();
+
+			m_Data = other.m_Data;
+			m_Size = other.m_Size;
+			m_Capacity = other.m_Capacity;
+
+			other.m_Data = nullptr;
+			other.m_Size = 0;
+			other.m_Capacity = 0;
+			return *this;
+		}
+
+		friend std::ostream& operator<<(std::ostream& stream, const FlatMap& flatMap) noexcept
+		{
+			stream << "[";
+
+			for (size_t i = 0; i < flatMap.m_Size; i++)
+			{
+				stream << flatMap.m_Data[i];
+				if (i + 1 < flatMap.m_Size)
+					stream << ", ";
+			}
+
+			stream << "]";
+			return stream;
+		}
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD static bool KeyLess(const KeyValuePair& left, const KeyValuePair& right) noexcept
+		{
+			return left.Component1 < right.Component1;
+		}
+
+		/// <summary>
+		/// Finds the index of the first pair whose key is not less than the given key. The loop halves the range
+		/// with a conditional move instead of a branch, so it runs the same number of iterations for every key.
+		/// </summary>
+		template <typename TLookup = TKey>
+		NODISCARD size_t LowerBound(const TLookup& key) const noexcept
+		{
+			if (m_Size == 0)
+				return 0;
+
+			const KeyValuePair* base = m_Data.Data;
+			size_t length = m_Size;
+			while (length > 1)
+			{
+				const size_t half = length / 2;
+				base = base[half].Component1 < key ? base + half : base;
+				length -= half;
+			}
+
+			return static_cast<size_t>(base - m_Data.Data) + (base->Component1 < key);
+		}
+
+		template <typename TLookup = TKey>
+		NODISCARD KeyValuePair* FindPair(const TLookup& key) const noexcept
+		{
+			const size_t index = LowerBound(key);
+			if (index < m_Size && m_Data.Data[index].Component1 == key)
+				return &m_Data.Data[index];
+
+			return nullptr;
+		}
+
+		/// <summary>
+		/// Gets the index a new pair with the given key belongs at, or nothing if the key already exists.
+		/// </summary>
+		NODISCARD Optional<size_t> InsertionIndex(const TKey& key) const noexcept
+		{
+			const size_t index = LowerBound(key);
+			if (index < m_Size && m_Data[index].Component1 == key)
+				return Optional<size_t>::Empty();
+
+			return Optional<size_t>(index);
+		}
+
+		template <typename TPair>
+		void EmplaceAt(const size_t index, TPair&& pair) noexcept
+		{
+			if (m_Size == m_Capacity)
+				Reallocate(m_Capacity == 0 ? DefaultCapacity : TGrowth::Grow(m_Capacity, m_Size + 1, sizeof(KeyValuePair)));
+
+			// Leaves a gap of raw memory at the index
+			ShiftRight(m_Data.Data, m_Size, index);
+
+			new(&m_Data[index]) KeyValuePair(std::forward<TPair>(pair));
+			++m_Size;
+		}
+
+		/// <summary>
+		/// Copies the pairs in, sorts them by key and drops repeated keys.
+		/// </summary>
+		void Build(const KeyValuePair* pairs, const size_t count) noexcept
+		{
+			if (count == 0)
+				return;
+
+			Allocate(count);
+			for (; m_Size < count; m_Size++)
+				new(&m_Data[m_Size]) KeyValuePair(pairs[m_Size]);
+
+			std::stable_sort(m_Data.Data, m_Data.Data + m_Size, KeyLess);
+			RemoveRepeatedKeys();
+		}
+
+		/// <summary>
+		/// Compacts a sorted block so each key appears once, keeping the first pair of every run.
+		/// </summary>
+		void RemoveRepeatedKeys() noexcept
+		{
+			if (m_Size == 0)
+				return;
+
+			size_t write = 1;
+			for (size_t read = 1; read < m_Size; read++)
+			{
+				if (m_Data[read].Component1 == m_Data[write - 1].Component1)
+					continue;
+
+				if (read != write)
+					m_Data[write] = std::move(m_Data[read]);
+				++write;
+			}
+
+			for (size_t i = write; i < m_Size; i++)
+				m_Data[i].~KeyValuePair();
+
+			m_Size = write;
+		}
+
+		constexpr void Allocate(const size_t capacity) noexcept
+		{
+			// A zero-sized block would never be disposed (the capacity says there is none)
+			if (capacity == 0)
+				return;
+
+			TRACK_ALLOCATION_OWNER(FlatMap);
+			m_Data = Alloc<KeyValuePair>(capacity);
+			m_Capacity = capacity;
+		}
+
+		constexpr void Reallocate(const size_t capacity) noexcept
+		{
+			TRACK_ALLOCATION_OWNER(FlatMap);
+			Memory<KeyValuePair> newBlock = Alloc<KeyValuePair>(capacity);
+			Relocate(m_Data.Data, m_Size, newBlock.Data);
+
+			Dispose();
+			m_Data = newBlock;
+			m_Capacity = capacity;
+		}
+
+		constexpr void Dispose() noexcept
+		{
+			if (m_Capacity != 0)
+				Delete(m_Data.Data, m_Capacity);
+
+			m_Data = nullptr;
+			m_Capacity = 0;
+		}
+
+	private:
+		Memory<KeyValuePair> m_Data = nullptr;
+		size_t m_Size = 0;
+		size_t m_Capacity = 0;
+
+	private:
+		constexpr static size_t DefaultCapacity = 8;
+	};
+}
@@ -0,0 +1,533 @@
+#pragma once
+#include <ostream>
+
+#include "Collections/Base/Enumerable.hpp"
+#include "Common/Span.hpp"
+#include "Core/Errors/Error.hpp"
+#include "Core/Function.hpp"
+#include "Core/Memory/GrowthPolicy.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Utility/Options/Optional.hpp"
+#include "Utility/Options/Result.hpp"
+
+namespace Micro
+{
+	/**
+	 * \brief Dynamically-sized list that keeps its first 'TInlineCapacity' elements inside the object itself, and only
+	 *		  moves them to the heap once it grows past that (small-buffer optimization). Shares List's API.
+	 * \tparam T Type of elements in list
+	 * \tparam TInlineCapacity Number of elements stored without allocating
+	 * \tparam TGrowth Policy picking the heap capacity to grow to when the list is full
+	 */
+	template <typename T, size_t TInlineCapacity, GrowthPolicy TGrowth = DoublingGrowth>
+	class InlineList final : public Enumerable<T>
+	{
+		static_assert(TInlineCapacity != 0, "Inline capacity must be greater than zero.");
+
+	public:
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		/**
+		 * \brief Initializes a new instance of the InlineList class, using the inline buffer.
+		 */
+		InlineList() noexcept = default;
+
+		/**
+		 * \brief Initializes a new instance of the InlineList class by copying the value of the given InlineList.
+		 * \param list InlineList to copy
+		 */
+		InlineList(const InlineList& list) noexcept
+		{
+			Reserve(list.m_Size);
+			for (size_t i = 0; i < list.m_Size; i++)
+				new(&m_Data[i]) T(list.m_Data[i]);
+			m_Size = list.m_Size;
+		}
+
+		/**
+		 * \brief Initializes a new instance of the InlineList class by moving the value of the given InlineList.
+		 *		  A heap buffer is taken over, inline elements are moved one by one.
+		 * \param list InlineList to move
+		 */
+		InlineList(InlineList&& list) noexcept { MoveFrom(std::move(list)); }
+
+		/**
+		 * \brief Initializes a new instance of the InlineList class by moving the value of the given initializer list.
+		 * \param initializerList Initializer list to move
+		 */
+		InlineList(std::initializer_list<T>&& initializerList) noexcept
+		{
+			Reserve(initializerList.size());
+			for (auto& elem : initializerList)
+				new(&m_Data[m_Size++]) T(std::move(const_cast<T&>(elem)));
+		}
+
+		/**
+		 * \brief Initializes a new instance of the InlineList class by copying the value of the given span.
+		 * \param span Span to copy
+		 */
+		explicit InlineList(const Span<T>& span) noexcept { AddRange(span); }
+
+		/**
+		 * \brief Initializes a new instance of the InlineList class with room for the given number of elements.
+		 * \param capacity Size to pre-allocate (nothing is allocated up to the inline capacity)
+		 */
+		explicit InlineList(const size_t capacity) noexcept { Reserve(capacity); }
+
+		/**
+		 * \brief Destroys the elements, then frees the heap buffer (if any).
+		 */
+		~InlineList() noexcept override { Release(); }
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD constexpr bool IsEmpty() const noexcept { return m_Size == 0; }
+		NODISCARD constexpr const T* Data() const noexcept { return m_Data; }
+		NODISCARD constexpr size_t Size() const noexcept { return m_Size; }
+		NODISCARD constexpr size_t Capacity() const noexcept { return m_Capacity; }
+		NODISCARD constexpr Span<T> AsSpan() const noexcept { return { m_Data, m_Size }; }
+
+		/// <summary>
+		/// Tests whether the elements are still stored inside the object (no heap allocation was made).
+		/// </summary>
+		NODISCARD bool IsInline() const noexcept { return m_Data == m_Inline.Data(); }
+
+		NODISCARD constexpr static size_t InlineCapacity() noexcept { return TInlineCapacity; }
+
+		/* Enumerators (Iterators) */
+
+		NODISCARD Enumerator<T> GetEnumerator() override
+		{
+			for (size_t i = 0; i < m_Size; i++)
+			{
+				auto& element = m_Data[i];
+				co_yield element;
+			}
+		}
+
+		NODISCARD Enumerator<T> GetEnumerator() const override
+		{
+			for (size_t i = 0; i < m_Size; i++)
+			{
+				const auto& element = m_Data[i];
+				co_yield element;
+			}
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Utility                          |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Adds the given value to the list by copy.
+		/// </summary>
+		/// <param name="value">Value to add to list</param>
+		void Add(const T& value) noexcept
+		{
+			if (m_Size == m_Capacity)
+			{
+				GrowAndEmplace(m_Size, value);
+				return;
+			}
+
+			new(&m_Data[m_Size++]) T(value);
+		}
+
+		/// <summary>
+		/// Adds the given value to the list by move.
+		/// </summary>
+		/// <param name="value">Value to add to list</param>
+		void Add(T&& value) noexcept
+		{
+			if (m_Size == m_Capacity)
+			{
+				GrowAndEmplace(m_Size, std::move(value));
+				return;
+			}
+
+			new(&m_Data[m_Size++]) T(std::move(value));
+		}
+
+		/// <summary>
+		/// Uses the given arguments to create the value inside the list.
+		/// </summary>
+		/// <param name="args">Args to create value inside the list</param>
+		///	<returns>Reference to the newly created value</returns>
+		template <typename... Args>
+		T& Emplace(Args&&... args) noexcept
+		{
+			if (m_Size == m_Capacity)
+				return GrowAndEmplace(m_Size, std::forward<Args>(args)...);
+
+			new(&m_Data[m_Size]) T(std::forward<Args>(args)...);
+			return m_Data[m_Size++];
+		}
+
+		/// <summary>
+		/// Adds all the elements from the given span to the list by copy.
+		/// </summary>
+		/// <param name="span">Span to add to the list</param>
+		void AddRange(const Span<T>& span) noexcept
+		{
+			const size_t size = span.Capacity();
+			if (size == 0)
+				return;
+
+			Reserve(m_Size + size);
+			for (size_t i = 0; i < size; i++)
+				new(&m_Data[m_Size++]) T(span[i]);
+		}
+
+		/// <summary>
+		/// Adds all the elements to the list by copy.
+		/// </summary>
+		/// <param name="elements">Elements to add to the list</param>
+		void AddRange(std::convertible_to<T> auto... elements) noexcept
+		{
+			constexpr size_t argumentCount = sizeof ...(elements);
+			static_assert(argumentCount != 0, "Cannot call 'AddRange' without any arguments!");
+
+			Reserve(m_Size + argumentCount);
+			(new(&m_Data[m_Size++]) T(static_cast<T>(std::move(elements))), ...);
+		}
+
+		Result<bool> Insert(const size_t index, const T& value) noexcept
+		{
+			return InsertEmplace(index, value).IsValid() ? Result<bool>::Ok(true) : OutOfRange(index);
+		}
+
+		Result<bool> Insert(const size_t index, T&& value) noexcept
+		{
+			return InsertEmplace(index, std::move(value)).IsValid() ? Result<bool>::Ok(true) : OutOfRange(index);
+		}
+
+		/// <summary>
+		/// Creates a value in front of the element at the given index (or at the end, if the index is the size).
+		/// </summary>
+		template <typename... Args>
+		Result<T&> InsertEmplace(const size_t index, Args&&... args) noexcept
+		{
+			if (index > m_Size)
+				return Result<T&>::CaptureError(ArgumentOutOfRangeError{ NAMEOF(index), index });
+
+			if (m_Size == m_Capacity)
+				return Result<T&>::Ok(GrowAndEmplace(index, std::forward<Args>(args)...));
+
+			// Created before shifting, since the arguments may refer to an element that is about to move
+			T value(std::forward<Args>(args)...);
+			ShiftRight(m_Data, m_Size, index);
+
+			new(&m_Data[index]) T(std::move(value));
+			++m_Size;
+			return Result<T&>::Ok(m_Data[index]);
+		}
+
+		bool Remove(const T& value) noexcept
+		{
+			const auto result = IndexOf(value);
+			if (!result.IsValid())
+				return false;
+
+			return RemoveAt(result.Value()).IsValid();
+		}
+
+		Result<bool> RemoveAt(const size_t index) noexcept
+		{
+			if (index >= m_Size)
+				return OutOfRange(index);
+
+			m_Data[index].~T();
+			ShiftLeft(m_Data, m_Size, index + 1);
+
+			--m_Size;
+			return Result<bool>::Ok(true);
+		}
+
+		Result<bool> RemoveRange(const size_t index, const size_t count) noexcept
+		{
+			const size_t length = index + count;
+			if (index >= m_Size || length > m_Size)
+				return Result<bool>::CaptureError(ArgumentOutOfRangeError{ "Invalid range from {} to {}.", index, length });
+
+			for (size_t i = index; i < length; i++)
+				m_Data[i].~T();
+
+			ShiftLeft(m_Data, m_Size, length, count);
+
+			m_Size -= count;
+			return Result<bool>::Ok(true);
+		}
+
+		size_t RemoveAll(const Predicate<T>& predicate) noexcept
+		{
+			// Survivors are compacted to the front in one pass
+			size_t length = 0;
+			for (size_t i = 0; i < m_Size; i++)
+			{
+				if (predicate(m_Data[i]))
+				{
+					m_Data[i].~T();
+					continue;
+				}
+
+				if (length != i)
+					Relocate(&m_Data[i], 1, &m_Data[length]);
+				++length;
+			}
+
+			const size_t count = m_Size - length;
+			m_Size = length;
+			return count;
+		}
+
+		/// <summary>
+		/// Destroys the elements. The current buffer (inline or heap) is kept.
+		/// </summary>
+		void Clear() noexcept
+		{
+			for (size_t i = 0; i < m_Size; i++)
+				m_Data[i].~T();
+			m_Size = 0;
+		}
+
+		/// <summary>
+		/// Makes sure the given number of elements fit without another allocation.
+		/// </summary>
+		void Reserve(const size_t capacity) noexcept
+		{
+			if (capacity > m_Capacity)
+				MoveToHeap(capacity);
+		}
+
+		/// <summary>
+		/// Moves the elements back into the inline buffer if they fit, otherwise into a heap buffer of exactly their size.
+		/// </summary>
+		void ShrinkToFit() noexcept
+		{
+			if (IsInline() || m_Size == m_Capacity)
+				return;
+
+			if (m_Size > TInlineCapacity)
+			{
+				MoveToHeap(m_Size);
+				return;
+			}
+
+			T* data = m_Inline.Data();
+			Relocate(m_Data, m_Size, data);
+			FreeHeapBuffer();
+
+			m_Data = data;
+			m_Capacity = TInlineCapacity;
+		}
+
+		NODISCARD constexpr bool Contains(const T& value) const noexcept { return Micro::Contains(AsSpan(), value); }
+
+		NODISCARD constexpr bool Equals(const InlineList& list) const noexcept { return Micro::Equals(AsSpan(), list.AsSpan()); }
+
+		NODISCARD constexpr Optional<size_t> IndexOf(const T& value) const noexcept { return Micro::IndexOf(AsSpan(), value); }
+
+		NODISCARD constexpr Optional<size_t> LastIndexOf(const T& value) const noexcept { return Micro::LastIndexOf(AsSpan(), value); }
+
+		NODISCARD Optional<size_t> FindIndex(const Predicate<T>& predicate) const noexcept
+		{
+			for (size_t i = 0; i < m_Size; i++)
+				if (predicate(m_Data[i]))
+					return Optional<size_t>(i);
+			return Optional<size_t>::Empty();
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Gets the element at the given index, or an empty result if invalid.
+		/// </summary>
+		/// <param name="index">Index of element</param>
+		/// <returns>Reference to the element at index, or empty result if invalid</returns>
+		NODISCARD Result<T&> operator[](const size_t index) noexcept
+		{
+			if (index >= m_Size)
+				return Result<T&>::CaptureError(IndexOutOfRangeError(index));
+
+			return Result<T&>::Ok(m_Data[index]);
+		}
+
+		/// <summary>
+		/// Gets the element at the given index, or an empty result if invalid. (const version)
+		/// </summary>
+		/// <param name="index">Index of element</param>
+		/// <returns>Reference to the element at index, or empty result if invalid</returns>
+		NODISCARD Result<const T&> operator[](const size_t index) const noexcept
+		{
+			if (index >= m_Size)
+				return Result<const T&>::CaptureError(IndexOutOfRangeError(index));
+
+			return Result<const T&>::Ok(m_Data[index]);
+		}
+
+		NODISCARD constexpr explicit operator Span<T>() const noexcept { return AsSpan(); }
+
+		InlineList& operator=(const InlineList& list) noexcept
+		{
+			if (this == &list)
+				return *this;
+
+			Clear();
+			Reserve(list.m_Size);
+			for (size_t i = 0; i < list.m_Size; i++)
+				new(&m_Data[i]) T(list.m_Data[i]);
+			m_Size = list.m_Size;
+
+			return *this;
+		}
+
+		InlineList& operator=(InlineList&& list) noexcept
+		{
+			if (this == &list)
+				return *this;
+
+			Release();
+			MoveFrom(std::move(list));
+			return *this;
+		}
+
+		friend std::ostream& operator<<(std::ostream& stream, const InlineList& current) noexcept
+		{
+			stream << "[";
+			for (size_t i = 0; i < current.m_Size; i++)
+			{
+				stream << current.m_Data[i];
+				if (i != current.m_Size - 1)
+					stream << ", ";
+			}
+
+			stream << "]";
+			return stream;
+		}
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Grows to the capacity chosen by the growth policy, so repeated adds past the inline capacity stay amortized O(1).
+		/// </summary>
+		void Grow(const size_t required) noexcept { MoveToHeap(TGrowth::Grow(m_Capacity, required, sizeof(T))); }
+
+		/// <summary>
+		/// Grows like 'Grow' while creating a value at the given index. The value is created in the new buffer before
+		/// the elements leave the old one, so the arguments may refer to an element of this list.
+		/// </summary>
+		template <typename... Args>
+		T& GrowAndEmplace(const size_t index, Args&&... args) noexcept
+		{
+			const size_t capacity = TGrowth::Grow(m_Capacity, m_Size + 1, sizeof(T));
+			T* data = AllocateBlock(capacity);
+			new(&data[index]) T(std::forward<Args>(args)...);
+
+			Relocate(m_Data, index, data);
+			Relocate(m_Data + index, m_Size - index, data + index + 1);
+			FreeHeapBuffer();
+
+			m_Data = data;
+			m_Capacity = capacity;
+			++m_Size;
+			return m_Data[index];
+		}
+
+		/// <summary>
+		/// Relocates the elements into a new heap buffer of the given capacity and frees the old one (if on the heap).
+		/// </summary>
+		void MoveToHeap(const size_t capacity) noexcept
+		{
+			T* data = AllocateBlock(capacity);
+			Relocate(m_Data, m_Size, data);
+			FreeHeapBuffer();
+
+			m_Data = data;
+			m_Capacity = capacity;
+		}
+
+		NODISCARD static T* AllocateBlock(const size_t capacity) noexcept
+		{
+			TRACK_ALLOCATION_OWNER(InlineList);
+			return Alloc<T>(capacity);
+		}
+
+		void FreeHeapBuffer() noexcept
+		{
+			if (!IsInline())
+				Delete(m_Data, m_Capacity);
+		}
+
+		/// <summary>
+		/// Destroys the elements, frees the heap buffer and goes back to the inline buffer.
+		/// </summary>
+		void Release() noexcept
+		{
+			Clear();
+			FreeHeapBuffer();
+
+			m_Data = m_Inline.Data();
+			m_Capacity = TInlineCapacity;
+		}
+
+		/// <summary>
+		/// Takes the elements of the other list, which must be released (or newly constructed) in this one.
+		/// </summary>
+		void MoveFrom(InlineList&& list) noexcept
+		{
+			if (list.IsInline())
+			{
+				Relocate(list.m_Data, list.m_Size, m_Data);
+				m_Size = list.m_Size;
+				list.m_Size = 0;
+				return;
+			}
+
+			m_Data = list.m_Data;
+			m_Size = list.m_Size;
+			m_Capacity = list.m_Capacity;
+
+			list.m_Data = list.m_Inline.Data();
+			list.m_Size = 0;
+			list.m_Capacity = TInlineCapacity;
+		}
+
+		static Result<bool> OutOfRange(const size_t index) noexcept
+		{
+			return Result<bool>::CaptureError(ArgumentOutOfRangeError{ NAMEOF(index), index });
+		}
+
+	private:
+		UninitializedStorage<T, TInlineCapacity> m_Inline;
+		T* m_Data = m_Inline.Data();
+		size_t m_Size = 0;
+		size_t m_Capacity = TInlineCapacity;
+	};
+}
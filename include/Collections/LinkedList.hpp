@@ -168,8 +168,7 @@ namespace Micro
 				// Remove references and free memory
 				if (poppedNode == Base::m_Head)
 				{
-					poppedNode->Invalidate();
-					delete poppedNode;
+					Base::DestroyNode(poppedNode);
 
 					Base::m_Head = nullptr;
 					Base::m_Tail = nullptr;
@@ -181,8 +180,7 @@ namespace Micro
 				auto prev = poppedNode->Prev;
 				prev->Next = nullptr;
 
-				poppedNode->Invalidate();
-				delete poppedNode;
+				Base::DestroyNode(poppedNode);
 
 				Base::m_Tail = prev;
 
@@ -204,8 +202,7 @@ namespace Micro
 				// Remove references and free memory
 				if (poppedNode == Base::m_Tail)
 				{
-					poppedNode->Invalidate();
-					delete poppedNode;
+					Base::DestroyNode(poppedNode);
 
 					Base::m_Head = nullptr;
 					Base::m_Tail = nullptr;
@@ -218,8 +215,7 @@ namespace Micro
 				auto next = poppedNode->Next;
 				next->Prev = nullptr;
 
-				poppedNode->Invalidate();
-				delete poppedNode;
+				Base::DestroyNode(poppedNode);
 
 				Base::m_Head = next;
 				--Base::m_Size;
@@ -239,7 +235,7 @@ namespace Micro
 			// Handle head removal
 			if (!Base::IsNodeValid(Base::m_Head->Next))
 			{
-				delete Base::m_Head;
+				Base::DestroyNode(Base::m_Head);
 
 				Base::m_Head = nullptr;
 				Base::m_Tail = nullptr;
@@ -263,7 +259,7 @@ namespace Micro
 				else if (Base::m_Tail == node)
 					Base::m_Tail = prev;
 
-				delete node;
+				Base::DestroyNode(node);
 
 				// Set pointers
 				if (Base::IsNodeValid(prev))
@@ -332,18 +328,8 @@ namespace Micro
 			if (other.IsEmpty())
 				return *this;
 
-			// Dispose
-			Base::Clear();
-
-			// Transfer
-			Base::m_Head = other.m_Head;
-			Base::m_Tail = other.m_Tail;
-			Base::m_Size = other.m_Size;
-
-			other.m_Head = nullptr;
-			other.m_Tail = nullptr;
-			other.m_Size = 0;
-
+			// Dispose, then transfer the nodes along with their pool
+			Base::operator=(std::move(other));
 			return *this;
 		}
 
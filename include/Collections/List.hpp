@@ -9,8 +9,8 @@ namespace Micro
 	 * \brief Represents a dynamically-sized heap-allocating structure for manipulating and searching through a contiguous block of memory.
 	 * \tparam T Type of elements in list
 	 */
-	template <typename T>
-	class List final : public HeapCollection<T>
+	template <typename T, CollectionAllocator<T> TAllocator = Allocator<T>, GrowthPolicy TGrowth = DoublingGrowth>
+	class List final : public HeapCollection<T, TAllocator, TGrowth>
 	{
 	public:
 		/*
@@ -20,7 +20,7 @@ namespace Micro
 		 */
 
 
-		using Base = HeapCollection<T>;
+		using Base = HeapCollection<T, TAllocator, TGrowth>;
 
 		
 		/*
@@ -102,6 +102,23 @@ namespace Micro
 		{
 		}
 
+		/**
+		 * \brief Initializes a new instance of the List class with an empty buffer, allocating through the given allocator.
+		 * \param allocator Allocator to use
+		 */
+		constexpr explicit List(const TAllocator& allocator) noexcept : Base(allocator)
+		{
+		}
+
+		/**
+		 * \brief Initializes a new instance of the List class with the given capacity, allocating through the given allocator.
+		 * \param capacity Size to pre-allocate
+		 * \param allocator Allocator to use
+		 */
+		constexpr List(const size_t capacity, const TAllocator& allocator) noexcept : Base(capacity, allocator)
+		{
+		}
+
 		/**
 		 * \brief Frees the memory from the underlying buffer, then setting all values to their default state.
 		 */
@@ -124,9 +141,12 @@ namespace Micro
 			if (!Base::m_Data.IsValidMemory())
 				Base::Allocate(DefaultCapacity);
 			else if (Base::m_Capacity <= Base::m_Size)
-				Base::Reallocate(Base::m_Capacity * 2);
+			{
+				Base::GrowAndEmplace(value);
+				return;
+			}
 
-			Base::m_Data[Base::m_Size++] = value;
+			new(&Base::m_Data[Base::m_Size++]) T(value);
 		}
 
 		/// <summary>
@@ -138,9 +158,12 @@ namespace Micro
 			if (!Base::m_Data.IsValidMemory())
 				Base::Allocate(DefaultCapacity);
 			else if (Base::m_Capacity <= Base::m_Size)
-				Base::Reallocate(Base::m_Capacity * 2);
+			{
+				Base::GrowAndEmplace(std::move(value));
+				return;
+			}
 
-			Base::m_Data[Base::m_Size++] = std::move(value);
+			new(&Base::m_Data[Base::m_Size++]) T(std::move(value));
 		}
 
 		/// <summary>
@@ -154,7 +177,7 @@ namespace Micro
 			if (!Base::m_Data.IsValidMemory())
 				Base::Allocate(DefaultCapacity);
 			else if (Base::m_Capacity <= Base::m_Size)
-				Base::Reallocate(Base::m_Capacity * 2);
+				return Base::GrowAndEmplace(std::forward<Args>(args)...);
 
 			new(&Base::m_Data[Base::m_Size]) T(std::forward<Args>(args)...);
 			return Base::m_Data[Base::m_Size++];
@@ -235,32 +258,14 @@ namespace Micro
 
 		constexpr Result<bool> Insert(const size_t index, const T& value) noexcept
 		{
-			if (Base::m_Size <= index)
-				return Result<bool>::CaptureError(ArgumentOutOfRangeError{ NAMEOF(index), index });
-
-			if (Base::m_Capacity <= Base::m_Size + 1)
-				Base::Reallocate(Base::m_Capacity * 2);
-
-			ShiftRight(Base::m_Data.Data, Base::m_Size, index);
-
-			Base::m_Data[index] = value;
-			++Base::m_Size;
-			return Result<bool>::Ok(true);
+			const auto result = InsertEmplace(index, value);
+			return result.IsValid() ? Result<bool>::Ok(true) : Result<bool>::CaptureError(result.ErrorHandle());
 		}
 
 		constexpr Result<bool> Insert(const size_t index, T&& value) noexcept
 		{
-			if (Base::m_Size <= index)
-				return Result<bool>::CaptureError(ArgumentOutOfRangeError{ NAMEOF(index), index });
-
-			if (Base::m_Capacity <= Base::m_Size + 1)
-				Base::Reallocate(Base::m_Capacity * 2);
-
-			ShiftRight(Base::m_Data.Data, Base::m_Size, index);
-
-			Base::m_Data[index] = std::move(value);
-			++Base::m_Size;
-			return Result<bool>::Ok(true);
+			const auto result = InsertEmplace(index, std::move(value));
+			return result.IsValid() ? Result<bool>::Ok(true) : Result<bool>::CaptureError(result.ErrorHandle());
 		}
 
 		template <typename... Args>
@@ -269,12 +274,14 @@ namespace Micro
 			if (Base::m_Size <= index)
 				return Result<T&>::CaptureError(ArgumentOutOfRangeError{ NAMEOF(index), index });
 
+			// Created before growing or shifting, since the arguments may refer to an element that is about to move
+			T value(std::forward<Args>(args)...);
 			if (Base::m_Capacity <= Base::m_Size + 1)
-				Base::Reallocate(Base::m_Capacity * 2);
+				Base::HandleReallocation(Base::m_Size + 1);
 
 			ShiftRight(Base::m_Data.Data, Base::m_Size, index);
 
-			new(&Base::m_Data[index]) T(std::forward<Args>(args)...);
+			new(&Base::m_Data[index]) T(std::move(value));
 			++Base::m_Size;
 			return Result<T&>::Ok(Base::m_Data[index]);
 		}
@@ -290,7 +297,7 @@ namespace Micro
 				return Result<bool>::CaptureError(ArgumentOutOfRangeError{ NAMEOF(startIndex), startIndex });
 
 			// Reallocate, if too small
-			const size_t length = collection.Capacity();
+			const size_t length = collection.Size();
 			const size_t reallocationSize = Base::m_Size + length;
 			if (Base::m_Capacity <= reallocationSize)
 				Base::HandleReallocation(reallocationSize);
@@ -301,7 +308,7 @@ namespace Micro
 			// Assign data
 			size_t index = startIndex;
 			for (auto& elem : collection)
-				Base::m_Data[index++] = elem;
+				new(&Base::m_Data[index++]) T(elem);
 
 			// Increment size
 			Base::m_Size += length;
@@ -319,7 +326,7 @@ namespace Micro
 				return Result<bool>::CaptureError(ArgumentOutOfRangeError{ NAMEOF(startIndex), startIndex });
 
 			// Reallocate, if too small
-			const size_t length = collection.Capacity();
+			const size_t length = collection.Size();
 			const size_t reallocationSize = Base::m_Size + length;
 			if (Base::m_Capacity <= reallocationSize)
 				Base::HandleReallocation(reallocationSize);
@@ -330,7 +337,7 @@ namespace Micro
 			// Assign data
 			size_t index = startIndex;
 			for (auto& elem : collection)
-				Base::m_Data[index++] = std::move(elem);
+				new(&Base::m_Data[index++]) T(std::move(elem));
 
 			// Increment size
 			Base::m_Size += length;
@@ -362,7 +369,7 @@ namespace Micro
 			// Assign data
 			size_t index = startIndex;
 			for (auto& elem : span)
-				Base::m_Data[index++] = elem;
+				new(&Base::m_Data[index++]) T(elem);
 
 			// Increment size
 			Base::m_Size += length;
@@ -389,7 +396,7 @@ namespace Micro
 			// Assign parameter args
 			size_t index = startIndex;
 			for (auto values = {static_cast<T>(elements)...}; auto&& elem : values)
-				Base::m_Data[index++] = std::move(elem);
+				new(&Base::m_Data[index++]) T(std::move(elem));
 
 			// Increment size
 			Base::m_Size += length;
@@ -611,24 +618,7 @@ namespace Micro
 		/// <returns>Reference of this instance</returns>
 		constexpr List& operator=(const List& list) noexcept
 		{
-			// Validation
-			if (this == &list)
-				return *this;
-
-			const size_t capacity = list.m_Capacity;
-			if (capacity == 0)
-				return *this;
-
-			// Allocation
-			if (!Base::IsEmpty())
-				Base::Reallocate(capacity);
-			else
-				Base::Allocate(capacity);
-
-			Base::m_Size = list.m_Size;
-
-			// Assignment
-			Base::CopyFrom(list);
+			Base::operator=(list);
 			return *this;
 		}
 
@@ -643,9 +633,9 @@ namespace Micro
 			if (this == &list)
 				return *this;
 
-			if (!Base::IsEmpty())
-				Base::Clear();
+			Base::Release();
 
+			Base::m_Allocator = std::move(list.m_Allocator);
 			Base::m_Data = list.m_Data;
 			Base::m_Size = list.m_Size;
 			Base::m_Capacity = list.m_Capacity;
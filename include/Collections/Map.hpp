@@ -1,7 +1,10 @@
 #pragma once
 
 #include "Utility/Tuple.hpp"
+#include "Core/Function.hpp"
 #include "Core/Memory/Memory.hpp"
+#include "Core/Errors/Error.hpp"
+#include "Common/Span.hpp"
 #include "Collections/Base/HashTable.hpp"
 
 namespace Micro
@@ -17,51 +20,40 @@ namespace Micro
 
 		// Fields
 		KeyValuePair Value;
-		MapNode* Next = nullptr;
-		MemStatus Status = MemStatus::Invalid;
 
 		// Constructors
-		constexpr MapNode() noexcept = default;
-
 		constexpr MapNode(const MapNode& other) noexcept
-			: Value(other.Value), Next(other.Next), Status(other.Status)
+			: Value(other.Value)
 		{
 		}
 
 		constexpr MapNode(MapNode&& other) noexcept
-			: Value(std::move(other.Value)), Next(other.Next), Status(other.Status)
+			: Value(std::move(other.Value))
 		{
-			other.Invalidate();
 		}
 
 		explicit constexpr MapNode(const KeyValuePair& value) noexcept
-			: Value(value), Status(MemStatus::Valid)
+			: Value(value)
 		{
 		}
 
 		explicit constexpr MapNode(KeyValuePair&& value) noexcept
-			: Value(std::move(value)), Status(MemStatus::Valid)
+			: Value(std::move(value))
 		{
 		}
 
-		constexpr ~MapNode() noexcept { Invalidate(); }
+		constexpr ~MapNode() noexcept = default;
 
 		// Utility
-		constexpr void Invalidate() noexcept
-		{
-			Next = nullptr;
-			Status = MemStatus::Invalid;
-		}
-
-		constexpr void Dispose() noexcept
-		{
-			Value.~KeyValuePair();
-		}
-
 		NODISCARD constexpr TKey& GetKey() noexcept { return Value.Component1; }
+		NODISCARD constexpr const TKey& GetKey() const noexcept { return Value.Component1; }
 		NODISCARD constexpr TValue& GetValue() noexcept { return Value.Component2; }
+		NODISCARD constexpr const TValue& GetValue() const noexcept { return Value.Component2; }
 		NODISCARD constexpr IteratorType& GetIteratorValue() noexcept { return Value; }
-		NODISCARD constexpr bool IsValid() const noexcept { return Status == MemStatus::Valid; }
+		NODISCARD constexpr const IteratorType& GetIteratorValue() const noexcept { return Value; }
+
+		// Static
+		NODISCARD constexpr static const TKey& KeyOf(const KeyValuePair& value) noexcept { return value.Component1; }
 
 		// Operator Overloads
 		MapNode& operator=(const MapNode& other) noexcept
@@ -70,9 +62,6 @@ namespace Micro
 				return *this;
 
 			Value = other.Value;
-			Next = other.Next;
-			Status = other.Status;
-
 			return *this;
 		}
 
@@ -82,15 +71,12 @@ namespace Micro
 				return *this;
 
 			Value = std::move(other.Value);
-			Next = other.Next;
-			Status = other.Status;
-
 			return *this;
 		}
 	};
 
 	template <typename TKey, typename TValue>
-	class Map final : public HashTable<Tuple<TKey, TValue>>
+	class Map final : public HashTable<MapNode<TKey, TValue>>
 	{
 	public:
 		// Aliases
@@ -123,6 +109,10 @@ namespace Micro
 		{
 		}
 
+		constexpr explicit Map(const Span<KeyValuePair>& pairs) noexcept : Base(pairs)
+		{
+		}
+
 		constexpr explicit Map(const size_t capacity) : Base(capacity)
 		{
 		}
@@ -132,12 +122,12 @@ namespace Micro
 		// Utility
 		bool Add(const TKey& key, const TValue& value) noexcept
 		{
-			return Base::Insert({ key, value });
+			return Base::Insert(KeyValuePair{ key, value });
 		}
 
 		bool Add(TKey&& key, TValue&& value) noexcept
 		{
-			return Base::Insert({std::move(key), std::move(value)});
+			return Base::Insert(KeyValuePair{ std::move(key), std::move(value) });
 		}
 
 		bool Add(const KeyValuePair& pair) noexcept
@@ -150,63 +140,86 @@ namespace Micro
 			return Base::Insert(std::move(pair));
 		}
 
+		size_t InsertRange(const Span<KeyValuePair>& pairs) noexcept
+		{
+			return Base::InsertRange(pairs.Data(), pairs.Capacity());
+		}
+
 		bool Remove(const TKey& key) noexcept
 		{
 			return Base::Erase(key);
 		}
 
-		NODISCARD const KeyValuePair& Find(const TKey& key) const
+		/// <summary>
+		/// Inserts the value if the key is missing, otherwise keeps the existing value.
+		/// </summary>
+		/// <returns>Value stored under the key</returns>
+		TValue& GetOrInsert(const TKey& key, const TValue& value) noexcept
 		{
-			// Gets the hashed value of the key
-			const size_t hash = Hash(key) % Base::m_Capacity;
+			return Base::FindOrInsert(key, [&] { return KeyValuePair{ key, value }; }).Component1->GetValue();
+		}
 
-			// Search bucket for matching key
-			auto bucket = &Base::m_Data[hash];
-			while (bucket != nullptr && bucket->IsValid())
-			{
-				if (bucket->Value.Component1 == key)
-					return bucket->Value;
+		TValue& GetOrInsert(const TKey& key, TValue&& value) noexcept
+		{
+			return Base::FindOrInsert(key, [&] { return KeyValuePair{ key, std::move(value) }; }).Component1->GetValue();
+		}
 
-				bucket = bucket->Next;
-			}
+		/// <summary>
+		/// Constructs the value from the arguments and inserts it, only if the key is missing (the arguments are
+		/// left untouched otherwise).
+		/// </summary>
+		/// <returns>True if the value was inserted</returns>
+		template <typename... Args>
+		bool TryEmplace(const TKey& key, Args&&... args) noexcept
+		{
+			return Base::FindOrInsert(key, [&] { return KeyValuePair{ key, TValue(std::forward<Args>(args)...) }; }).Component2;
+		}
 
-			// Throw exception if key is not found (key hashes to valid index but is not present)
-			throw KeyNotFoundError("Key could not be found in the Map.", NAMEOF(key));
+		NODISCARD Optional<const TValue&> Find(const TKey& key) const noexcept
+		{
+			if (const Node* node = Base::FindNode(key))
+				return Optional<const TValue&>(node->GetValue());
+
+			return Optional<const TValue&>::Empty();
 		}
 
-		NODISCARD KeyValuePair& Find(const TKey& key)
+		NODISCARD Optional<TValue&> Find(const TKey& key) noexcept
 		{
-			// Gets the hashed value of the key
-			const size_t hash = Hash(key) % Base::m_Capacity;
+			if (Node* node = Base::FindNode(key))
+				return Optional<TValue&>(node->GetValue());
 
-			// Search bucket for matching key
-			auto bucket = &Base::m_Data[hash];
-			while (bucket != nullptr && bucket->IsValid())
-			{
-				if (bucket->GetKey() == key)
-					return bucket->Value;
+			return Optional<TValue&>::Empty();
+		}
 
-				bucket = bucket->Next;
-			}
+		/// <summary>
+		/// Finds the value whose key equals the lookup value (e.g. a StringBuffer or char pointer for String keys),
+		/// without converting the lookup value to a key.
+		/// </summary>
+		template <TransparentKey<TKey> TLookup>
+		NODISCARD Optional<const TValue&> Find(const TLookup& key) const noexcept
+		{
+			if (const Node* node = Base::FindNode(key))
+				return Optional<const TValue&>(node->GetValue());
 
-			// Throw exception if key is not found (key hashes to valid index but is not present)
-			throw KeyNotFoundError("Key could not be found in the Map.", NAMEOF(key));
+			return Optional<const TValue&>::Empty();
+		}
+
+		template <TransparentKey<TKey> TLookup>
+		NODISCARD Optional<TValue&> Find(const TLookup& key) noexcept
+		{
+			if (Node* node = Base::FindNode(key))
+				return Optional<TValue&>(node->GetValue());
+
+			return Optional<TValue&>::Empty();
 		}
 
-		NODISCARD Optional<KeyValuePair> Find(const Predicate<const TKey&> predicate) const noexcept
+		NODISCARD Optional<KeyValuePair> Find(const Predicate<TKey>& predicate) const noexcept
 		{
-			auto metaData = Base::m_MetaData;
-			while (metaData != nullptr)
+			for (size_t i = 0; i < Base::m_Size; i++)
 			{
-				// Search bucket for matching key
-				auto bucket = metaData->BucketReference;
-				while (bucket != nullptr && bucket->IsValid())
-				{
-					if (predicate(bucket->Value.Component1))
-						return RefResult(bucket->Value);
-
-					bucket = bucket->Next;
-				}
+				const auto& pair = Base::NodeAt(i).Value;
+				if (predicate(pair.Component1))
+					return Optional<KeyValuePair>(pair);
 			}
 
 			return Optional<KeyValuePair>::Empty();
@@ -214,117 +227,71 @@ namespace Micro
 
 		NODISCARD bool ContainsKey(const TKey& key) const noexcept
 		{
-			// Get hash of bucket
-			auto bucket = &Base::m_Data[Hash(key) % Base::m_Capacity];
-			if (!bucket->IsValid())
-				return false;
-
-			// Loop through bucket for matching value
-			while (bucket != nullptr)
-			{
-				if (bucket->Value.Component1 == key)
-					return true;
-
-				bucket = bucket->Next;
-			}
+			return Base::FindNode(key) != nullptr;
+		}
 
-			return false;
+		template <TransparentKey<TKey> TLookup>
+		NODISCARD bool ContainsKey(const TLookup& key) const noexcept
+		{
+			return Base::FindNode(key) != nullptr;
 		}
 
 		NODISCARD bool ContainsValue(const TValue& value) const noexcept
 		{
-			auto metaData = Base::m_MetaData;
-			while (metaData != nullptr)
-			{
-				auto bucket = metaData->BucketReference;
-				while (bucket != nullptr && bucket->IsValid())
-				{
-					if (bucket->GetValue() == value)
-						return true;
-
-					bucket = bucket->Next;
-				}
+			for (size_t i = 0; i < Base::m_Size; i++)
+				if (Base::NodeAt(i).GetValue() == value)
+					return true;
 
-				metaData = metaData->Next;
-			}
 			return false;
 		}
 
-		NODISCARD bool TryGetValue(const TKey& key, TValue& out) noexcept
+		NODISCARD bool TryGetValue(const TKey& key, TValue& out) const noexcept
 		{
-			// Get hash of bucket
-			auto bucket = &Base::m_Data[Hash(key) % Base::m_Capacity];
-			if (!bucket->IsValid())
+			const Node* node = Base::FindNode(key);
+			if (node == nullptr)
 				return false;
 
-			// Loop through bucket for matching value
-			while (bucket != nullptr)
-			{
-				if (bucket->GetKey() == key)
-				{
-					out = bucket->GetValue();
-					return true;
-				}
+			out = node->GetValue();
+			return true;
+		}
 
-				bucket = bucket->Next;
-			}
+		template <TransparentKey<TKey> TLookup>
+		NODISCARD bool TryGetValue(const TLookup& key, TValue& out) const noexcept
+		{
+			const Node* node = Base::FindNode(key);
+			if (node == nullptr)
+				return false;
 
-			return false;
+			out = node->GetValue();
+			return true;
 		}
 
 		// Operator Overloads
 		NODISCARD const TValue& operator[](const TKey& key) const
 		{
-			const size_t hash = Hash(key) % Base::m_Capacity;
-			const auto& pair = Base::m_Data[hash];
+			if (const Node* node = Base::FindNode(key))
+				return node->GetValue();
 
-			if (!pair.IsValid())
-				throw KeyNotFoundError("Key could not be found in the Map.", NAMEOF(key));
-
-			return pair.Value.Component2;
+			throw KeyNotFoundError("Key could not be found in the Map.", NAMEOF(key));
 		}
 
 		NODISCARD TValue& operator[](const TKey& key)
 		{
-			const size_t hash = Hash(key) % Base::m_Capacity;
-			auto& pair = Base::m_Data[hash];
+			if (Node* node = Base::FindNode(key))
+				return node->GetValue();
 
-			if (!pair.IsValid())
-				throw KeyNotFoundError("Key could not be found in the Map.", NAMEOF(key));
-
-			return pair.Value.Component2;
+			throw KeyNotFoundError("Key could not be found in the Map.", NAMEOF(key));
 		}
 
 		Map& operator=(const Map& other)
 		{
-			if (this == &other)
-				return *this;
-
-			Base::Clear();
-
-			Base::CopyFrom(other);
-
+			Base::operator=(other);
 			return *this;
 		}
 
 		Map& operator=(Map&& other) noexcept
 		{
-			if (this == &other)
-				return *this;
-
-			Base::Clear();
-
-			Base::m_Data = other.m_Data;
-			Base::m_MetaData = other.m_MetaData;
-			Base::m_Capacity = other.m_Capacity;
-			Base::m_Size = other.m_Size;
-			Base::m_LoadFactor = other.m_LoadFactor;
-
-			other.m_Data = nullptr;
-			other.m_MetaData = nullptr;
-			other.m_Capacity = 0;
-			other.m_Size = 0;
-			other.m_LoadFactor = 0;
+			Base::operator=(std::move(other));
 			return *this;
 		}
 	};
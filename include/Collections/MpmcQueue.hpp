@@ -0,0 +1,382 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#include "Core/Core.hpp"
+#include "Core/Typedef.hpp"
+#include "Core/Errors/Error.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Utility/Options/Optional.hpp"
+#include "Utility/Options/Result.hpp"
+
+namespace Micro
+{
+	namespace Internal
+	{
+		/// <summary>
+		/// Slot of an MpmcQueue. The sequence says whose turn it is: equal to the position, the slot is free for the
+		/// producer that claims that position; one past it, the slot holds an element for the consumer of that position.
+		/// </summary>
+		template <typename T>
+		struct MpmcSlot final
+		{
+			std::atomic<size_t> Sequence;
+			UninitializedStorage<T, 1> Storage;
+		};
+	}
+
+	/**
+	 * \brief Bounded lock-free queue for any number of producer and consumer threads (Vyukov's algorithm). Producers
+	 *		  and consumers claim a position with a single CAS on their own counter, then hand the slot over through
+	 *		  its sequence counter, so there is no lock and no shared write besides the counters.
+	 *		  The Try functions never block. Enqueue/Dequeue spin briefly and then park the thread (futex where
+	 *		  std::atomic::wait uses one) until a slot or an element is available, or the queue is closed.
+	 * \tparam T Type of elements in queue
+	 */
+	template <typename T>
+	class MpmcQueue final
+	{
+	public:
+		/*
+		 *  ============================================================
+		 *	|                          Aliases                         |
+		 *  ============================================================
+		 */
+
+
+		using Slot = Internal::MpmcSlot<T>;
+
+
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Creates an empty queue.
+		/// </summary>
+		/// <param name="capacity">Maximum number of elements (rounded up to a power of two, at least 2)</param>
+		explicit MpmcQueue(const size_t capacity) noexcept
+			: m_Capacity(MAX(std::bit_ceil(capacity), size_t(2)))
+		{
+			TRACK_ALLOCATION_OWNER(MpmcQueue);
+			m_Slots = AlignedAlloc<Slot>(m_Capacity, CACHE_LINE_SIZE);
+			for (size_t i = 0; i < m_Capacity; i++)
+				new(&m_Slots[i].Sequence) std::atomic<size_t>(i);
+		}
+
+		// Every thread refers to the queue by address
+		MpmcQueue(const MpmcQueue&) = delete;
+		MpmcQueue(MpmcQueue&&) = delete;
+
+		/// <summary>
+		/// Destroys the elements that were never dequeued. No thread may use the queue anymore.
+		/// </summary>
+		~MpmcQueue() noexcept
+		{
+			const size_t tail = m_EnqueuePosition.load(std::memory_order_relaxed);
+			for (size_t head = m_DequeuePosition.load(std::memory_order_relaxed); head != tail; head++)
+				m_Slots[head & (m_Capacity - 1)].Storage.Data()->~T();
+
+			AlignedDelete(m_Slots, m_Capacity, CACHE_LINE_SIZE);
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD size_t Capacity() const noexcept { return m_Capacity; }
+
+		/// <summary>
+		/// Number of elements, which is only a snapshot while other threads are running.
+		/// </summary>
+		NODISCARD size_t Size() const noexcept
+		{
+			const size_t head = m_DequeuePosition.load(std::memory_order_acquire);
+			return MIN(m_EnqueuePosition.load(std::memory_order_acquire) - head, m_Capacity);
+		}
+
+		NODISCARD bool IsEmpty() const noexcept { return Size() == 0; }
+		NODISCARD bool IsClosed() const noexcept { return m_IsClosed.load(std::memory_order_acquire); }
+
+
+		/*
+		 *  ============================================================
+		 *	|                       Non-blocking                       |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Enqueues a copy of the value, unless the queue is full.
+		/// </summary>
+		/// <returns>True, if enqueued</returns>
+		NODISCARD bool TryEnqueue(const T& value) noexcept { return TryEmplace(value); }
+
+		/// <summary>
+		/// Enqueues the value by move, unless the queue is full (the value is left untouched then).
+		/// </summary>
+		/// <returns>True, if enqueued</returns>
+		NODISCARD bool TryEnqueue(T&& value) noexcept { return TryEmplace(std::move(value)); }
+
+		/// <summary>
+		/// Creates the value in the next free slot, unless the queue is full.
+		/// </summary>
+		/// <returns>True, if enqueued</returns>
+		template <typename... Args>
+		NODISCARD bool TryEmplace(Args&&... args) noexcept
+		{
+			size_t position = m_EnqueuePosition.load(std::memory_order_relaxed);
+			Slot* slot;
+			while (true)
+			{
+				slot = &m_Slots[position & (m_Capacity - 1)];
+				const size_t sequence = slot->Sequence.load(std::memory_order_acquire);
+				const auto difference = static_cast<intptr_t>(sequence - position);
+
+				if (difference == 0)
+				{
+					if (m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				// The slot still holds the element from one lap ago
+				else if (difference < 0)
+					return false;
+				else
+					position = m_EnqueuePosition.load(std::memory_order_relaxed);
+			}
+
+			new(slot->Storage.Data()) T(std::forward<Args>(args)...);
+			slot->Sequence.store(position + 1, std::memory_order_release);
+
+			Notify(m_ElementSignal, m_ElementWaiters);
+			return true;
+		}
+
+		/// <summary>
+		/// Dequeues the oldest element, unless the queue is empty.
+		/// </summary>
+		/// <returns>Oldest element, or an empty optional</returns>
+		NODISCARD Optional<T> TryDequeue() noexcept
+		{
+			size_t position = m_DequeuePosition.load(std::memory_order_relaxed);
+			Slot* slot;
+			while (true)
+			{
+				slot = &m_Slots[position & (m_Capacity - 1)];
+				const size_t sequence = slot->Sequence.load(std::memory_order_acquire);
+				const auto difference = static_cast<intptr_t>(sequence - (position + 1));
+
+				if (difference == 0)
+				{
+					if (m_DequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				// The producer of this position hasn't published yet
+				else if (difference < 0)
+					return Optional<T>::Empty();
+				else
+					position = m_DequeuePosition.load(std::memory_order_relaxed);
+			}
+
+			T* element = slot->Storage.Data();
+			Optional<T> value(std::move(*element));
+			element->~T();
+
+			// Frees the slot for the producer one lap ahead
+			slot->Sequence.store(position + m_Capacity, std::memory_order_release);
+
+			Notify(m_SlotSignal, m_SlotWaiters);
+			return value;
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Blocking                         |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Enqueues a copy of the value, waiting for a free slot if the queue is full.
+		/// </summary>
+		/// <returns>True, or an InvalidOperationError if the queue is (or gets) closed first</returns>
+		NODISCARD Result<bool> Enqueue(const T& value) noexcept
+		{
+			if (Wait([&] { return TryEmplace(value); }, m_SlotSignal, m_SlotWaiters))
+				return Result<bool>::Ok(true);
+			return Result<bool>::CaptureError(InvalidOperationError("Cannot enqueue to closed MpmcQueue!"));
+		}
+
+		/// <summary>
+		/// Enqueues the value by move, waiting for a free slot if the queue is full.
+		/// </summary>
+		/// <returns>True, or an InvalidOperationError if the queue is (or gets) closed first (the value is left untouched then)</returns>
+		NODISCARD Result<bool> Enqueue(T&& value) noexcept
+		{
+			if (Wait([&] { return TryEmplace(std::move(value)); }, m_SlotSignal, m_SlotWaiters))
+				return Result<bool>::Ok(true);
+			return Result<bool>::CaptureError(InvalidOperationError("Cannot enqueue to closed MpmcQueue!"));
+		}
+
+		/// <summary>
+		/// Dequeues the oldest element, waiting for one if the queue is empty. A closed queue is still drained.
+		/// </summary>
+		/// <returns>Oldest element, or an InvalidOperationError if the queue is closed and empty</returns>
+		NODISCARD Result<T> Dequeue() noexcept
+		{
+			Optional<T> value;
+			if (Wait([&] { return (value = TryDequeue()).IsValid(); }, m_ElementSignal, m_ElementWaiters) ||
+				(value = TryDequeue()).IsValid())
+				return Result<T>::Ok(std::move(value.Value()));
+
+			return Result<T>::CaptureError(InvalidOperationError("Cannot dequeue from closed and empty MpmcQueue!"));
+		}
+
+		/// <summary>
+		/// Copies the oldest element without dequeuing it. Only a snapshot: another consumer may dequeue it right away.
+		/// Limited to trivially copyable types, which can be read while a consumer moves them out.
+		/// </summary>
+		/// <returns>Copy of the oldest element, or an InvalidOperationError if the queue is empty</returns>
+		NODISCARD Result<T> Peek() const noexcept requires std::is_trivially_copyable_v<T>
+		{
+			size_t position = m_DequeuePosition.load(std::memory_order_relaxed);
+			while (true)
+			{
+				const Slot& slot = m_Slots[position & (m_Capacity - 1)];
+				const size_t sequence = slot.Sequence.load(std::memory_order_acquire);
+				const auto difference = static_cast<intptr_t>(sequence - (position + 1));
+
+				if (difference < 0)
+					return Result<T>::CaptureError(InvalidOperationError("Cannot peek from empty MpmcQueue!"));
+
+				if (difference == 0)
+				{
+					// Valid if no producer refilled the slot during the copy (seqlock read)
+					UninitializedStorage<T, 1> copy;
+					std::memcpy(copy.Bytes, slot.Storage.Bytes, sizeof(T));
+					std::atomic_thread_fence(std::memory_order_acquire);
+
+					if (slot.Sequence.load(std::memory_order_relaxed) == sequence)
+						return Result<T>::Ok(*copy.Data());
+				}
+
+				position = m_DequeuePosition.load(std::memory_order_relaxed);
+			}
+		}
+
+		/// <summary>
+		/// Closes the queue: blocking enqueues fail from now on, blocking dequeues fail once the queue is empty, and
+		/// every parked thread wakes up. The Try functions are unaffected.
+		/// </summary>
+		void Close() noexcept
+		{
+			m_IsClosed.store(true, std::memory_order_release);
+
+			m_SlotSignal.fetch_add(1, std::memory_order_release);
+			m_SlotSignal.notify_all();
+			m_ElementSignal.fetch_add(1, std::memory_order_release);
+			m_ElementSignal.notify_all();
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		MpmcQueue& operator=(const MpmcQueue&) = delete;
+		MpmcQueue& operator=(MpmcQueue&&) = delete;
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Retries the operation until it succeeds or the queue is closed. Spins with growing pauses first, then parks
+		/// on the signal after announcing itself in the waiter count.
+		/// </summary>
+		/// <returns>True, if the operation succeeded</returns>
+		template <typename TFunc>
+		NODISCARD bool Wait(TFunc&& attempt, std::atomic<u32>& signal, std::atomic<u32>& waiters) noexcept
+		{
+			for (u32 spin = 0; spin < SpinCount; spin++)
+			{
+				if (IsClosed())
+					return false;
+				if (attempt())
+					return true;
+
+				for (u32 i = 0; i < (1u << spin); i++)
+					CPU_PAUSE();
+			}
+
+			while (!IsClosed())
+			{
+				// Read before retrying, so a notification between the retry and the wait isn't lost
+				const u32 current = signal.load(std::memory_order_acquire);
+				waiters.fetch_add(1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				if (attempt())
+				{
+					waiters.fetch_sub(1, std::memory_order_relaxed);
+					return true;
+				}
+
+				if (!IsClosed())
+					signal.wait(current, std::memory_order_acquire);
+				waiters.fetch_sub(1, std::memory_order_relaxed);
+			}
+
+			return false;
+		}
+
+		/// <summary>
+		/// Wakes one parked thread, if there is any. Paired with the fence in 'Wait': either the waiter sees the change
+		/// on its retry, or this sees the waiter.
+		/// </summary>
+		static void Notify(std::atomic<u32>& signal, const std::atomic<u32>& waiters) noexcept
+		{
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (waiters.load(std::memory_order_relaxed) == 0)
+				return;
+
+			signal.fetch_add(1, std::memory_order_release);
+			signal.notify_one();
+		}
+
+	private:
+		// Claimed by producers
+		alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_EnqueuePosition = 0;
+
+		// Claimed by consumers
+		alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_DequeuePosition = 0;
+
+		// Read-mostly, only written while threads park
+		alignas(CACHE_LINE_SIZE) Slot* m_Slots = nullptr;
+		size_t m_Capacity;
+		std::atomic<u32> m_ElementSignal = 0;
+		std::atomic<u32> m_ElementWaiters = 0;
+		std::atomic<u32> m_SlotSignal = 0;
+		std::atomic<u32> m_SlotWaiters = 0;
+		std::atomic<bool> m_IsClosed = false;
+
+		static constexpr u32 SpinCount = 8;
+	};
+}
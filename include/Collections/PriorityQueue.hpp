@@ -0,0 +1,631 @@
+#pragma once
+#include <functional>
+
+#include "Collections/Base/Collection.hpp"
+#include "Collections/List.hpp"
+#include "Collections/Stack.hpp"
+#include "Core/Typedef.hpp"
+#include "Utility/Options/Result.hpp"
+
+namespace Micro
+{
+	namespace Internal
+	{
+		/// <summary>
+		/// Does nothing with the new index of a moved heap element (the plain PriorityQueue doesn't track them).
+		/// </summary>
+		struct IgnoreHeapMove final
+		{
+			constexpr void operator()(size_t) const noexcept
+			{
+			}
+		};
+
+		/// <summary>
+		/// Moves the element at the index towards the root while it has priority over its parent.
+		/// 'onMove(index)' is called for every element that lands on a new index.
+		/// </summary>
+		template <size_t TArity, typename T, typename TCompare, typename TOnMove>
+		constexpr void HeapSiftUp(T* data, size_t index, const TCompare& compare, const TOnMove& onMove) noexcept
+		{
+			// Parents are shifted down into the hole, and the element is only placed once
+			T value = std::move(data[index]);
+			while (index > 0)
+			{
+				const size_t parent = (index - 1) / TArity;
+				if (!compare(value, data[parent]))
+					break;
+
+				data[index] = std::move(data[parent]);
+				onMove(index);
+				index = parent;
+			}
+
+			data[index] = std::move(value);
+			onMove(index);
+		}
+
+		/// <summary>
+		/// Moves the element at the index towards the leaves while one of its children has priority over it.
+		/// 'onMove(index)' is called for every element that lands on a new index.
+		/// </summary>
+		template <size_t TArity, typename T, typename TCompare, typename TOnMove>
+		constexpr void HeapSiftDown(T* data, const size_t size, size_t index, const TCompare& compare, const TOnMove& onMove) noexcept
+		{
+			T value = std::move(data[index]);
+			while (true)
+			{
+				const size_t firstChild = index * TArity + 1;
+				if (firstChild >= size)
+					break;
+
+				size_t best = firstChild;
+				const size_t lastChild = MIN(firstChild + TArity, size);
+				for (size_t child = firstChild + 1; child < lastChild; child++)
+					if (compare(data[child], data[best]))
+						best = child;
+
+				if (!compare(data[best], value))
+					break;
+
+				data[index] = std::move(data[best]);
+				onMove(index);
+				index = best;
+			}
+
+			data[index] = std::move(value);
+			onMove(index);
+		}
+
+		/// <summary>
+		/// Orders the elements into a heap bottom-up (Floyd), in O(n).
+		/// </summary>
+		template <size_t TArity, typename T, typename TCompare, typename TOnMove>
+		constexpr void HeapMake(T* data, const size_t size, const TCompare& compare, const TOnMove& onMove) noexcept
+		{
+			if (size < 2)
+				return;
+
+			for (size_t parent = (size - 2) / TArity + 1; parent-- > 0;)
+				HeapSiftDown<TArity>(data, size, parent, compare, onMove);
+		}
+	}
+
+	/**
+	 * \brief Priority queue stored as an implicit d-ary heap in the contiguous block of a HeapCollection. Push and Pop
+	 *		  are O(log n), building from a span is O(n). A wider heap is shallower and reads the children of a node
+	 *		  from one or two cache lines, which pays off over the binary heap once the heap leaves the cache.
+	 *		  Enumerates in heap order, not in priority order.
+	 * \tparam T Type of elements
+	 * \tparam TCompare 'compare(left, right)' tells if left has priority over right (std::less pops the smallest first)
+	 * \tparam TArity Number of children per node (2 is a binary heap)
+	 * \tparam TAllocator Allocator owning the element block (Allocator&lt;T&gt; goes to the global heap)
+	 * \tparam TGrowth Policy picking the capacity to grow to when the block is full
+	 */
+	template <typename T, typename TCompare = std::less<T>, size_t TArity = 4, CollectionAllocator<T> TAllocator = Allocator<T>,
+	          GrowthPolicy TGrowth = DoublingGrowth>
+	class PriorityQueue final : public HeapCollection<T, TAllocator, TGrowth>
+	{
+		static_assert(TArity >= 2, "A heap node needs at least two children.");
+
+	public:
+		/*
+		 *  ============================================================
+		 *	|                          Aliases                         |
+		 *  ============================================================
+		 */
+
+
+		using Base = HeapCollection<T, TAllocator, TGrowth>;
+
+
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		constexpr PriorityQueue() noexcept : Base()
+		{
+		}
+
+		constexpr PriorityQueue(const PriorityQueue& queue) noexcept : Base(queue), m_Compare(queue.m_Compare)
+		{
+		}
+
+		constexpr PriorityQueue(PriorityQueue&& queue) noexcept : Base(std::move(queue)), m_Compare(std::move(queue.m_Compare))
+		{
+		}
+
+		constexpr explicit PriorityQueue(const TCompare& compare) noexcept : Base(), m_Compare(compare)
+		{
+		}
+
+		constexpr PriorityQueue(std::initializer_list<T>&& initializerList) noexcept : Base(std::move(initializerList))
+		{
+			Heapify();
+		}
+
+		/// <summary>
+		/// Copies the elements of the span and orders them into a heap in O(n).
+		/// </summary>
+		constexpr explicit PriorityQueue(const Span<T>& span, const TCompare& compare = TCompare()) noexcept
+			: Base(span), m_Compare(compare)
+		{
+			Heapify();
+		}
+
+		constexpr explicit PriorityQueue(const size_t capacity) noexcept : Base(capacity)
+		{
+		}
+
+		constexpr explicit PriorityQueue(const TAllocator& allocator) noexcept : Base(allocator)
+		{
+		}
+
+		constexpr PriorityQueue(const size_t capacity, const TAllocator& allocator) noexcept : Base(capacity, allocator)
+		{
+		}
+
+		constexpr ~PriorityQueue() noexcept override = default;
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Utility                          |
+		 *  ============================================================
+		 */
+
+
+		constexpr void Push(const T& value) noexcept
+		{
+			Grow(Base::m_Size + 1);
+			new(&Base::m_Data[Base::m_Size++]) T(value);
+			Internal::HeapSiftUp<TArity>(Base::m_Data.Data, Base::m_Size - 1, m_Compare, Internal::IgnoreHeapMove());
+		}
+
+		constexpr void Push(T&& value) noexcept
+		{
+			Grow(Base::m_Size + 1);
+			new(&Base::m_Data[Base::m_Size++]) T(std::move(value));
+			Internal::HeapSiftUp<TArity>(Base::m_Data.Data, Base::m_Size - 1, m_Compare, Internal::IgnoreHeapMove());
+		}
+
+		template <typename... Args>
+		constexpr void Emplace(Args&&... args) noexcept
+		{
+			Grow(Base::m_Size + 1);
+			new(&Base::m_Data[Base::m_Size++]) T(std::forward<Args>(args)...);
+			Internal::HeapSiftUp<TArity>(Base::m_Data.Data, Base::m_Size - 1, m_Compare, Internal::IgnoreHeapMove());
+		}
+
+		/// <summary>
+		/// Pushes copies of all the elements of the span. Rebuilds the heap in O(n) instead when the span is larger
+		/// than the queue, which beats pushing them one by one.
+		/// </summary>
+		/// <param name="span">Span to add to the queue</param>
+		constexpr void PushRange(const Span<T>& span) noexcept
+		{
+			if (span.IsEmpty())
+				return;
+
+			const size_t size = span.Capacity();
+			const T* data = span.Data();
+			if (size <= Base::m_Size)
+			{
+				Base::HandleReallocation(Base::m_Size + size);
+				for (size_t i = 0; i < size; i++)
+					Push(data[i]);
+				return;
+			}
+
+			Grow(Base::m_Size + size);
+			for (size_t i = 0; i < size; i++)
+				new(&Base::m_Data[Base::m_Size++]) T(data[i]);
+			Heapify();
+		}
+
+		/// <summary>
+		/// Removes the element with the highest priority.
+		/// </summary>
+		/// <returns>Element with the highest priority, or an InvalidOperationError if the queue is empty</returns>
+		NODISCARD constexpr Result<T> Pop() noexcept
+		{
+			if (Base::IsEmpty())
+				return Result<T>::CaptureError(InvalidOperationError("Cannot pop from empty PriorityQueue!"));
+
+			T* data = Base::m_Data.Data;
+			T item = std::move(data[0]);
+
+			// The last leaf fills the root and sinks back down
+			--Base::m_Size;
+			if (Base::m_Size != 0)
+			{
+				data[0] = std::move(data[Base::m_Size]);
+				Internal::HeapSiftDown<TArity>(data, Base::m_Size, 0, m_Compare, Internal::IgnoreHeapMove());
+			}
+
+			data[Base::m_Size].~T();
+			return Result<T>::Ok(std::move(item));
+		}
+
+		/// <summary>
+		/// Gets the element with the highest priority. Read-only, since changing it could break the heap order.
+		/// </summary>
+		/// <returns>Element with the highest priority, or an InvalidOperationError if the queue is empty</returns>
+		NODISCARD constexpr Result<const T&> Peek() const noexcept
+		{
+			if (Base::IsEmpty())
+				return Result<const T&>::CaptureError(InvalidOperationError("Cannot peek from empty PriorityQueue!"));
+
+			return Result<const T&>::Ok(Base::m_Data[0]);
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		constexpr PriorityQueue& operator=(const PriorityQueue& queue) noexcept
+		{
+			Base::operator=(queue);
+			m_Compare = queue.m_Compare;
+			return *this;
+		}
+
+		constexpr PriorityQueue& operator=(PriorityQueue&& queue) noexcept
+		{
+			// Validation
+			if (this == &queue)
+				return *this;
+
+			Base::Release();
+
+			Base::m_Allocator = std::move(queue.m_Allocator);
+			Base::m_Data = queue.m_Data;
+			Base::m_Size = queue.m_Size;
+			Base::m_Capacity = queue.m_Capacity;
+			m_Compare = std::move(queue.m_Compare);
+
+			queue.m_Data = nullptr;
+			queue.m_Size = 0;
+			queue.m_Capacity = 0;
+
+			return *this;
+		}
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		constexpr void Grow(const size_t required) noexcept
+		{
+			if (!Base::m_Data.IsValidMemory())
+				Base::Allocate(MAX(required, DefaultCapacity));
+			else
+				Base::HandleReallocation(required);
+		}
+
+		constexpr void Heapify() noexcept
+		{
+			Internal::HeapMake<TArity>(Base::m_Data.Data, Base::m_Size, m_Compare, Internal::IgnoreHeapMove());
+		}
+
+	private:
+		NO_UNIQUE_ADDRESS TCompare m_Compare{};
+
+		static constexpr size_t DefaultCapacity = 16;
+	};
+
+
+	/**
+	 * \brief Refers to an element of an IndexedPriorityQueue while it is queued. Handles of popped or removed
+	 *		  elements are recognized as stale, even after their slot is reused.
+	 */
+	struct PriorityHandle final
+	{
+		u32 Slot = ~0u;
+		u32 Generation = 0;
+
+		constexpr friend bool operator==(const PriorityHandle&, const PriorityHandle&) noexcept = default;
+	};
+
+
+	/**
+	 * \brief Priority queue whose elements can be reprioritized or removed through the handle returned by Push, in
+	 *		  O(log n). The elements stay in a slot table and the d-ary heap only orders slot indices, so sifting moves
+	 *		  4 byte indices instead of elements, and keeps each slot's heap position up to date.
+	 * \tparam T Type of elements
+	 * \tparam TCompare 'compare(left, right)' tells if left has priority over right (std::less pops the smallest first)
+	 * \tparam TArity Number of children per node (2 is a binary heap)
+	 */
+	template <typename T, typename TCompare = std::less<T>, size_t TArity = 4>
+	class IndexedPriorityQueue final
+	{
+		static_assert(TArity >= 2, "A heap node needs at least two children.");
+
+		struct Slot final
+		{
+			T Value;
+			size_t Position;
+			u32 Generation;
+		};
+
+	public:
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		constexpr IndexedPriorityQueue() noexcept = default;
+		constexpr IndexedPriorityQueue(const IndexedPriorityQueue&) noexcept = default;
+		constexpr IndexedPriorityQueue(IndexedPriorityQueue&&) noexcept = default;
+
+		constexpr explicit IndexedPriorityQueue(const TCompare& compare) noexcept : m_Compare(compare)
+		{
+		}
+
+		constexpr ~IndexedPriorityQueue() noexcept = default;
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD constexpr size_t Size() const noexcept { return m_Heap.Size(); }
+		NODISCARD constexpr bool IsEmpty() const noexcept { return m_Heap.IsEmpty(); }
+
+		/// <summary>
+		/// Checks if the handle refers to a queued element.
+		/// </summary>
+		NODISCARD constexpr bool Contains(const PriorityHandle handle) const noexcept
+		{
+			if (handle.Slot >= m_Slots.Size())
+				return false;
+
+			const Slot& slot = m_Slots.Data()[handle.Slot];
+			return slot.Generation == handle.Generation && slot.Position != InvalidPosition;
+		}
+
+		/// <summary>
+		/// Gets the element the handle refers to. Read-only, use 'DecreaseKey' to change it.
+		/// </summary>
+		/// <returns>Element, or an InvalidOperationError if the handle is stale</returns>
+		NODISCARD constexpr Result<const T&> Get(const PriorityHandle handle) const noexcept
+		{
+			if (!Contains(handle))
+				return Result<const T&>::CaptureError(InvalidOperationError("Handle doesn't refer to a queued element!"));
+
+			return Result<const T&>::Ok(m_Slots.Data()[handle.Slot].Value);
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Utility                          |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Pushes a copy of the value.
+		/// </summary>
+		/// <returns>Handle to the element</returns>
+		constexpr PriorityHandle Push(const T& value) noexcept { return Insert(T(value)); }
+
+		/// <summary>
+		/// Pushes the value by move.
+		/// </summary>
+		/// <returns>Handle to the element</returns>
+		constexpr PriorityHandle Push(T&& value) noexcept { return Insert(std::move(value)); }
+
+		/// <summary>
+		/// Removes the element with the highest priority. Its handle becomes stale.
+		/// </summary>
+		/// <returns>Element with the highest priority, or an InvalidOperationError if the queue is empty</returns>
+		NODISCARD constexpr Result<T> Pop() noexcept
+		{
+			if (IsEmpty())
+				return Result<T>::CaptureError(InvalidOperationError("Cannot pop from empty PriorityQueue!"));
+
+			return Result<T>::Ok(Extract(0));
+		}
+
+		/// <summary>
+		/// Gets the element with the highest priority.
+		/// </summary>
+		/// <returns>Element with the highest priority, or an InvalidOperationError if the queue is empty</returns>
+		NODISCARD constexpr Result<const T&> Peek() const noexcept
+		{
+			if (IsEmpty())
+				return Result<const T&>::CaptureError(InvalidOperationError("Cannot peek from empty PriorityQueue!"));
+
+			return Result<const T&>::Ok(m_Slots.Data()[m_Heap.Data()[0]].Value);
+		}
+
+		/// <summary>
+		/// Gets the handle of the element with the highest priority.
+		/// </summary>
+		/// <returns>Handle, or an InvalidOperationError if the queue is empty</returns>
+		NODISCARD constexpr Result<PriorityHandle> PeekHandle() const noexcept
+		{
+			if (IsEmpty())
+				return Result<PriorityHandle>::CaptureError(InvalidOperationError("Cannot peek from empty PriorityQueue!"));
+
+			const u32 index = m_Heap.Data()[0];
+			return Result<PriorityHandle>::Ok(PriorityHandle{ index, m_Slots.Data()[index].Generation });
+		}
+
+		/// <summary>
+		/// Replaces the element with a value of higher (or equal) priority and moves it up the heap.
+		/// </summary>
+		/// <param name="handle">Handle to the element</param>
+		/// <param name="value">New value, which must not have a lower priority than the current one</param>
+		/// <returns>True, or an InvalidOperationError if the handle is stale or the value has a lower priority</returns>
+		constexpr Result<bool> DecreaseKey(const PriorityHandle handle, T value) noexcept
+		{
+			if (!Contains(handle))
+				return Result<bool>::CaptureError(InvalidOperationError("Handle doesn't refer to a queued element!"));
+
+			Slot& slot = Slots()[handle.Slot];
+			if (m_Compare(slot.Value, value))
+				return Result<bool>::CaptureError(InvalidOperationError("New key has a lower priority than the current one!"));
+
+			slot.Value = std::move(value);
+			SiftUp(slot.Position);
+			return Result<bool>::Ok(true);
+		}
+
+		/// <summary>
+		/// Removes the element the handle refers to. The handle becomes stale.
+		/// </summary>
+		/// <returns>Removed element, or an InvalidOperationError if the handle is stale</returns>
+		NODISCARD constexpr Result<T> Remove(const PriorityHandle handle) noexcept
+		{
+			if (!Contains(handle))
+				return Result<T>::CaptureError(InvalidOperationError("Handle doesn't refer to a queued element!"));
+
+			return Result<T>::Ok(Extract(Slots()[handle.Slot].Position));
+		}
+
+		/// <summary>
+		/// Removes every element. All handles become stale.
+		/// </summary>
+		constexpr void Clear() noexcept
+		{
+			while (!IsEmpty())
+				(void)Extract(m_Heap.Size() - 1);
+		}
+
+		/// <summary>
+		/// Makes room for the given number of elements, so pushing up to it doesn't reallocate.
+		/// </summary>
+		constexpr void Reserve(const size_t capacity) noexcept
+		{
+			m_Heap.Reserve(capacity);
+			m_Slots.Reserve(capacity);
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		constexpr IndexedPriorityQueue& operator=(const IndexedPriorityQueue&) noexcept = default;
+		constexpr IndexedPriorityQueue& operator=(IndexedPriorityQueue&&) noexcept = default;
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD constexpr u32* Heap() noexcept { return const_cast<u32*>(m_Heap.Data()); }
+		NODISCARD constexpr Slot* Slots() noexcept { return const_cast<Slot*>(m_Slots.Data()); }
+
+		/// <summary>
+		/// Stores the value in a free slot (reusing released ones first) and sifts it into the heap.
+		/// </summary>
+		constexpr PriorityHandle Insert(T&& value) noexcept
+		{
+			const size_t position = m_Heap.Size();
+
+			u32 index;
+			if (Result<u32> released = m_FreeSlots.Pop(); released.IsValid())
+			{
+				index = released.Value();
+				Slot& slot = Slots()[index];
+				slot.Value = std::move(value);
+				slot.Position = position;
+			}
+			else
+			{
+				index = static_cast<u32>(m_Slots.Size());
+				m_Slots.Add(Slot{ std::move(value), position, 0 });
+			}
+
+			m_Heap.Add(index);
+			SiftUp(position);
+			return PriorityHandle{ index, Slots()[index].Generation };
+		}
+
+		/// <summary>
+		/// Takes the element at the heap position out, fills the gap with the last leaf and releases its slot.
+		/// </summary>
+		NODISCARD constexpr T Extract(const size_t position) noexcept
+		{
+			u32* heap = Heap();
+			Slot& slot = Slots()[heap[position]];
+			T value = std::move(slot.Value);
+
+			slot.Position = InvalidPosition;
+			++slot.Generation;
+			m_FreeSlots.Push(heap[position]);
+
+			const size_t last = m_Heap.Size() - 1;
+			heap[position] = heap[last];
+			(void)m_Heap.RemoveAt(last);
+
+			// The leaf may belong above or below the gap
+			if (position != last)
+			{
+				Slots()[heap[position]].Position = position;
+				if (position > 0 && CompareAt(heap[position], heap[(position - 1) / TArity]))
+					SiftUp(position);
+				else
+					Internal::HeapSiftDown<TArity>(heap, m_Heap.Size(), position, Comparer(), PositionTracker());
+			}
+
+			return value;
+		}
+
+		constexpr void SiftUp(const size_t position) noexcept
+		{
+			Internal::HeapSiftUp<TArity>(Heap(), position, Comparer(), PositionTracker());
+		}
+
+		NODISCARD constexpr bool CompareAt(const u32 left, const u32 right) const noexcept
+		{
+			return m_Compare(m_Slots.Data()[left].Value, m_Slots.Data()[right].Value);
+		}
+
+		NODISCARD constexpr auto Comparer() const noexcept
+		{
+			return [this](const u32 left, const u32 right) { return CompareAt(left, right); };
+		}
+
+		/// <summary>
+		/// Records the new heap position in the slot of every index the sift moves.
+		/// </summary>
+		NODISCARD constexpr auto PositionTracker() noexcept
+		{
+			return [this](const size_t position) { Slots()[Heap()[position]].Position = position; };
+		}
+
+	private:
+		List<u32> m_Heap;
+		List<Slot> m_Slots;
+		Stack<u32> m_FreeSlots;
+		NO_UNIQUE_ADDRESS TCompare m_Compare{};
+
+		static constexpr size_t InvalidPosition = ~size_t(0);
+	};
+}
@@ -1,12 +1,22 @@
 #pragma once
+#include <ostream>
 
 #include "Collections/Base/Collection.hpp"
 #include "Utility/Options/Optional.hpp"
+#include "Utility/Options/Result.hpp"
 
 namespace Micro
 {
-	template <typename T>
-	class Queue final : public HeapCollection<T>
+	/**
+	 * \brief First-in-first-out queue stored as a growable circular buffer. Elements are enqueued at the tail and
+	 *		  dequeued from the head, so neither end ever shifts the others (O(1) Enqueue/Dequeue/Peek). Growing
+	 *		  unwraps the elements into the front of the new block.
+	 * \tparam T Type of elements in queue
+	 * \tparam TAllocator Allocator owning the element block (Allocator&lt;T&gt; goes to the global heap)
+	 * \tparam TGrowth Policy picking the capacity to grow to when the block is full
+	 */
+	template <typename T, CollectionAllocator<T> TAllocator = Allocator<T>, GrowthPolicy TGrowth = DoublingGrowth>
+	class Queue final : public Enumerable<T>
 	{
 	public:
 		/*
@@ -16,9 +26,9 @@ namespace Micro
 		 */
 
 
-		using Base = HeapCollection<T>;
+		using Collection = HeapCollection<T, TAllocator, TGrowth>;
+
 
-		
 		/*
 		 *  ============================================================
 		 *	|                  Constructors/Destructors                |
@@ -26,46 +36,104 @@ namespace Micro
 		 */
 
 
-		constexpr Queue() noexcept : Base()
-		{
-		}
+		constexpr Queue() noexcept = default;
 
-		constexpr Queue(const Queue& other) noexcept : Base(other)
+		constexpr Queue(const Queue& other) noexcept
+			: m_Allocator(other.m_Allocator)
 		{
+			if (other.IsEmpty())
+				return;
+
+			Allocate(other.m_Size);
+			CopyFrom(other);
 		}
 
-		constexpr Queue(Queue&& other) noexcept : Base(std::move(other))
+		constexpr Queue(Queue&& other) noexcept
+			: m_Data(other.m_Data), m_Head(other.m_Head), m_Size(other.m_Size), m_Capacity(other.m_Capacity),
+			  m_Allocator(std::move(other.m_Allocator))
 		{
+			other.Forget();
 		}
 
-		constexpr Queue(const Base& other) noexcept : Base(other)
+		/// <summary>
+		/// Enqueues the elements of the collection in order, so the first one is dequeued first.
+		/// </summary>
+		constexpr explicit Queue(const Collection& collection) noexcept { EnqueueRange(collection.AsSpan()); }
+
+		constexpr Queue(std::initializer_list<T>&& initializerList) noexcept
 		{
+			const size_t length = initializerList.size();
+			if (length == 0)
+				return;
+
+			Allocate(length);
+			for (auto& elem : initializerList)
+				new(&m_Data[m_Size++]) T(std::move(const_cast<T&>(elem)));
 		}
 
-		constexpr Queue(Base&& other) noexcept : Base(std::move(other))
+		constexpr explicit Queue(const Span<T>& span) noexcept { EnqueueRange(span); }
+
+		constexpr explicit Queue(std::convertible_to<T> auto... elements) noexcept
 		{
+			constexpr size_t length = sizeof ...(elements);
+			Allocate(length);
+
+			for (auto values = { static_cast<T>(std::move(elements))... }; auto&& elem : values)
+				new(&m_Data[m_Size++]) T(std::move(elem));
 		}
 
-		constexpr Queue(std::initializer_list<T>&& initializerList) noexcept : Base(std::move(initializerList))
+		constexpr explicit Queue(const size_t capacity) noexcept { Allocate(capacity); }
+
+		constexpr explicit Queue(const TAllocator& allocator) noexcept
+			: m_Allocator(allocator)
 		{
 		}
 
-		constexpr explicit Queue(const Span<T>& other) noexcept : Base(other)
+		constexpr Queue(const size_t capacity, const TAllocator& allocator) noexcept
+			: m_Allocator(allocator)
 		{
+			Allocate(capacity);
 		}
 
-		constexpr explicit Queue(std::convertible_to<T> auto... elements) noexcept : Base(
-			std::forward<T>(static_cast<T>(elements))...)
+		constexpr ~Queue() noexcept override { Release(); }
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD constexpr bool IsEmpty() const noexcept { return m_Size == 0; }
+		NODISCARD constexpr size_t Size() const noexcept { return m_Size; }
+		NODISCARD constexpr size_t Capacity() const noexcept { return m_Capacity; }
+		NODISCARD constexpr const TAllocator& GetAllocator() const noexcept { return m_Allocator; }
+
+		/* Enumerators (Iterators) */
+
+		/// <summary>
+		/// Enumerates the elements from the head (next to dequeue) to the tail.
+		/// </summary>
+		NODISCARD Enumerator<T> GetEnumerator() override
 		{
+			for (size_t i = 0; i < m_Size; i++)
+			{
+				auto& element = m_Data[Wrap(m_Head + i)];
+				co_yield element;
+			}
 		}
 
-		constexpr explicit Queue(const size_t capacity) noexcept : Base(capacity)
+		NODISCARD Enumerator<T> GetEnumerator() const override
 		{
+			for (size_t i = 0; i < m_Size; i++)
+			{
+				const auto& element = m_Data[Wrap(m_Head + i)];
+				co_yield element;
+			}
 		}
 
-		constexpr ~Queue() noexcept override = default;
 
-		
 		/*
 		 *  ============================================================
 		 *	|                         Utility                          |
@@ -75,57 +143,42 @@ namespace Micro
 
 		constexpr void Enqueue(const T& value) noexcept
 		{
-			if (!Base::m_Data.IsValidMemory())
-				Base::Allocate(DefaultCapacity);
-			else if (Base::m_Capacity <= Base::m_Size)
-				Base::Reallocate(Base::m_Capacity * 2);
+			if (m_Size == m_Capacity)
+			{
+				GrowAndEmplace(value);
+				return;
+			}
 
-			ShiftRight<T>(Base::m_Data, Base::m_Size, 0);
-			Base::m_Data[0] = value;
-			++Base::m_Size;
+			new(&m_Data[Wrap(m_Head + m_Size)]) T(value);
+			++m_Size;
 		}
 
 		constexpr void Enqueue(T&& value) noexcept
 		{
-			if (!Base::m_Data.IsValidMemory())
-				Base::Allocate(DefaultCapacity);
-			else if (Base::m_Capacity <= Base::m_Size)
-				Base::Reallocate(Base::m_Capacity * 2);
+			if (m_Size == m_Capacity)
+			{
+				GrowAndEmplace(std::move(value));
+				return;
+			}
 
-			ShiftRight<T>(Base::m_Data, Base::m_Size, 0);
-			Base::m_Data[0] = std::move(value);
-			++Base::m_Size;
+			new(&m_Data[Wrap(m_Head + m_Size)]) T(std::move(value));
+			++m_Size;
 		}
 
 		template <typename... Args>
 		constexpr T& Emplace(Args&&... args) noexcept
 		{
-			if (!Base::m_Data.IsValidMemory())
-				Base::Allocate(DefaultCapacity);
-			else if (Base::m_Capacity <= Base::m_Size)
-				Base::Reallocate(Base::m_Capacity * 2);
+			if (m_Size == m_Capacity)
+				return GrowAndEmplace(std::forward<Args>(args)...);
 
-			ShiftRight<T>(Base::m_Data, Base::m_Size, 0);
-			new(&Base::m_Data[0]) T(std::forward<Args>(args)...);
-			return Base::m_Data[0];
+			T* element = new(&m_Data[Wrap(m_Head + m_Size)]) T(std::forward<Args>(args)...);
+			++m_Size;
+			return *element;
 		}
 
-		constexpr void EnqueueRange(const Base& collection) noexcept
-		{
-			if (collection.IsEmpty())
-				return;
-
-			const size_t size = collection.Size();
-			const T* data = collection.Data();
+		constexpr void EnqueueRange(const Collection& collection) noexcept { EnqueueRange(collection.AsSpan()); }
 
-			const size_t length = Base::m_Size + size;
-			Base::HandleReallocation(length);
-
-			for (size_t i = 0; i < size; i++)
-				Enqueue(data[i]);
-		}
-
-		constexpr void EnqueueRange(Base&& collection) noexcept
+		constexpr void EnqueueRange(Collection&& collection) noexcept
 		{
 			if (collection.IsEmpty())
 				return;
@@ -133,9 +186,7 @@ namespace Micro
 			const size_t size = collection.Size();
 			T* data = const_cast<T*>(collection.Data());
 
-			const size_t length = Base::m_Size + size;
-			Base::HandleReallocation(length);
-
+			Reserve(m_Size + size);
 			for (size_t i = 0; i < size; i++)
 				Enqueue(std::move(data[i]));
 		}
@@ -152,9 +203,7 @@ namespace Micro
 			const size_t size = span.Capacity();
 			const T* data = span.Data();
 
-			const size_t length = Base::m_Size + size;
-			Base::HandleReallocation(length);
-
+			Reserve(m_Size + size);
 			for (size_t i = 0; i < size; i++)
 				Enqueue(data[i]);
 		}
@@ -164,33 +213,91 @@ namespace Micro
 			constexpr size_t argumentCount = sizeof ...(elements);
 			static_assert(argumentCount != 0, "Cannot call 'EnqueueRange' without any arguments!");
 
-			const size_t length = Base::m_Size + argumentCount;
-			Base::HandleReallocation(length);
-
+			Reserve(m_Size + argumentCount);
 			for (auto values = { static_cast<T>(std::move(elements))... }; auto && item : values)
 				Enqueue(std::move(item));
 		}
 
 		NODISCARD constexpr Result<T> Dequeue() noexcept
 		{
-			if (!Base::IsEmpty())
-			{
-				auto item = std::move(Base::m_Data[0]);
-				Base::m_Data[0].~T();
+			if (IsEmpty())
+				return Result<T>::CaptureError(InvalidOperationError("Cannot dequeue from empty Queue!"));
 
-				ShiftLeft<T>(Base::m_Data, Base::m_Size, 1);
-				--Base::m_Size;
-				return Result<T>::Ok(std::move(item));
-			}
-			return Result<T>::CaptureError(InvalidOperationError("Cannot dequeue from empty Queue!"));
+			T& head = m_Data[m_Head];
+			auto item = std::move(head);
+			head.~T();
+
+			m_Head = Wrap(m_Head + 1);
+			--m_Size;
+			return Result<T>::Ok(std::move(item));
+		}
+
+		NODISCARD constexpr Result<T&> Peek() noexcept
+		{
+			if (IsEmpty())
+				return Result<T&>::CaptureError(InvalidOperationError("Cannot peek from empty Queue!"));
+
+			return Result<T&>::Ok(m_Data[m_Head]);
 		}
 
-		NODISCARD constexpr Result<T&> Peek() const noexcept
+		NODISCARD constexpr Result<const T&> Peek() const noexcept
+		{
+			if (IsEmpty())
+				return Result<const T&>::CaptureError(InvalidOperationError("Cannot peek from empty Queue!"));
+
+			return Result<const T&>::Ok(m_Data[m_Head]);
+		}
+
+		/// <summary>
+		/// Tests if both queues hold equal elements in the same order.
+		/// </summary>
+		NODISCARD constexpr bool Equals(const Queue& queue) const noexcept
+		{
+			if (m_Size != queue.m_Size)
+				return false;
+
+			for (size_t i = 0; i < m_Size; i++)
+				if (!(m_Data[Wrap(m_Head + i)] == queue.m_Data[queue.Wrap(queue.m_Head + i)]))
+					return false;
+			return true;
+		}
+
+		NODISCARD constexpr bool Contains(const T& value) const noexcept
+		{
+			for (size_t i = 0; i < m_Size; i++)
+				if (m_Data[Wrap(m_Head + i)] == value)
+					return true;
+			return false;
+		}
+
+		constexpr void Clear() noexcept
+		{
+			for (size_t i = 0; i < m_Size; i++)
+				m_Data[Wrap(m_Head + i)].~T();
+
+			m_Head = 0;
+			m_Size = 0;
+		}
+
+		/// <summary>
+		/// Makes room for the given number of elements, so enqueuing up to it doesn't reallocate. Never shrinks.
+		/// </summary>
+		/// <param name="capacity">Number of elements to make room for</param>
+		constexpr void Reserve(const size_t capacity) noexcept
 		{
-			if (!Base::IsEmpty())
-				return Result<T&>::Ok(Base::m_Data[0]);
+			if (capacity > m_Capacity)
+				Reallocate(capacity);
+		}
 
-			return Result<T&>::CaptureError(InvalidOperationError("Cannot peek from empty Queue!"));
+		/// <summary>
+		/// Reallocates the block to fit the elements exactly, or releases it if the queue is empty.
+		/// </summary>
+		constexpr void ShrinkToFit() noexcept
+		{
+			if (m_Size == 0)
+				Release();
+			else if (m_Capacity > m_Size)
+				Reallocate(m_Size);
 		}
 
 
@@ -208,24 +315,18 @@ namespace Micro
 		/// <returns>Reference of this instance</returns>
 		constexpr Queue& operator=(const Queue& queue) noexcept
 		{
-			// Validation
 			if (this == &queue)
 				return *this;
 
-			const size_t capacity = queue.m_Capacity;
-			if (capacity == 0)
-				return *this;
-
-			// Allocation
-			if (!Base::IsEmpty())
-				Base::Reallocate(capacity);
-			else
-				Base::Allocate(capacity);
-
-			Base::m_Size = queue.m_Size;
+			// The current block is reused when it is large enough
+			Clear();
+			if (m_Capacity < queue.m_Size)
+			{
+				Release();
+				Allocate(queue.m_Size);
+			}
 
-			// Assignment
-			Base::CopyFrom(queue);
+			CopyFrom(queue);
 			return *this;
 		}
 
@@ -240,21 +341,147 @@ namespace Micro
 			if (this == &queue)
 				return *this;
 
-			if (!Base::IsEmpty())
-				Base::Clear();
-
-			Base::m_Data = queue.m_Data;
-			Base::m_Size = queue.m_Size;
-			Base::m_Capacity = queue.m_Capacity;
+			// The block belongs to the other allocator, so it comes along with it
+			Release();
 
-			queue.m_Data = nullptr;
-			queue.m_Size = 0;
-			queue.m_Capacity = 0;
+			m_Allocator = std::move(queue.m_Allocator);
+			m_Data = queue.m_Data;
+			m_Head = queue.m_Head;
+			m_Size = queue.m_Size;
+			m_Capacity = queue.m_Capacity;
 
+			queue.Forget();
 			return *this;
 		}
 
+		friend std::ostream& operator<<(std::ostream& stream, const Queue& current) noexcept
+		{
+			stream << "[";
+			for (size_t i = 0; i < current.m_Size; i++)
+			{
+				stream << current.m_Data[current.Wrap(current.m_Head + i)];
+				if (i != current.m_Size - 1)
+					stream << ", ";
+			}
+
+			stream << "]";
+			return stream;
+		}
+
 	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Maps a position past the head (at most twice the capacity) back into the block.
+		/// </summary>
+		NODISCARD constexpr size_t Wrap(const size_t index) const noexcept
+		{
+			return index >= m_Capacity ? index - m_Capacity : index;
+		}
+
+		constexpr void Allocate(const size_t capacity) noexcept
+		{
+			TRACK_ALLOCATION_OWNER(Queue);
+			if (capacity != 0)
+				m_Capacity = m_Allocator.Allocate(m_Data, m_Capacity, capacity);
+		}
+
+		/// <summary>
+		/// Moves the elements into a new block of the given capacity (at least the size), unwrapping them so the
+		/// head ends up at index 0.
+		/// </summary>
+		constexpr void Reallocate(const size_t capacity) noexcept
+		{
+			TRACK_ALLOCATION_OWNER(Queue);
+			Memory<T> block = nullptr;
+			const size_t newCapacity = m_Allocator.Allocate(block, 0, capacity);
+
+			// The elements sit in at most two runs: [head, capacity) and [0, tail)
+			if (m_Size != 0)
+			{
+				const size_t first = MIN(m_Size, m_Capacity - m_Head);
+				Relocate(&m_Data[m_Head], first, block.Data);
+				Relocate(m_Data.Data, m_Size - first, &block[first]);
+			}
+
+			if (m_Capacity != 0)
+				m_Allocator.Dispose(m_Data, m_Capacity);
+
+			m_Data = block;
+			m_Head = 0;
+			m_Capacity = newCapacity;
+		}
+
+		/// <summary>
+		/// Grows to the capacity chosen by the growth policy (the first block holds at least 'DefaultCapacity').
+		/// </summary>
+		constexpr void Grow(const size_t required) noexcept
+		{
+			if (m_Capacity == 0)
+				Reallocate(MAX(required, DefaultCapacity));
+			else
+				Reallocate(TGrowth::Grow(m_Capacity, required, sizeof(T)));
+		}
+
+		/// <summary>
+		/// Grows the block for one more element and creates it at the back. The value is created before the elements
+		/// are relocated, so the arguments may refer to one of them.
+		/// </summary>
+		template <typename... Args>
+		constexpr T& GrowAndEmplace(Args&&... args) noexcept
+		{
+			T value(std::forward<Args>(args)...);
+			Grow(m_Size + 1);
+
+			T* element = new(&m_Data[Wrap(m_Head + m_Size)]) T(std::move(value));
+			++m_Size;
+			return *element;
+		}
+
+		/// <summary>
+		/// Copy constructs the elements of the other queue, in order, into this (empty) queue's block.
+		/// </summary>
+		constexpr void CopyFrom(const Queue& other) noexcept
+		{
+			for (size_t i = 0; i < other.m_Size; i++)
+				new(&m_Data[i]) T(other.m_Data[other.Wrap(other.m_Head + i)]);
+
+			m_Head = 0;
+			m_Size = other.m_Size;
+		}
+
+		/// <summary>
+		/// Destroys the elements and gives the block back to the allocator.
+		/// </summary>
+		constexpr void Release() noexcept
+		{
+			Clear();
+			if (m_Capacity != 0)
+				m_Allocator.Dispose(m_Data, m_Capacity);
+
+			Forget();
+		}
+
+		constexpr void Forget() noexcept
+		{
+			m_Data = nullptr;
+			m_Head = 0;
+			m_Size = 0;
+			m_Capacity = 0;
+		}
+
+	private:
+		Memory<T> m_Data = nullptr;
+		size_t m_Head = 0;
+		size_t m_Size = 0;
+		size_t m_Capacity = 0;
+		NO_UNIQUE_ADDRESS TAllocator m_Allocator{};
+
 		static constexpr size_t DefaultCapacity = 16;
 	};
 }
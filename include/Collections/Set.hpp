@@ -15,51 +15,40 @@ namespace Micro
 
 		// Fields
 		T Value;
-		SetNode* Next = nullptr;
-		MemStatus Status = MemStatus::Invalid;
 
 		// Constructors
-		constexpr SetNode() noexcept = default;
-
 		constexpr SetNode(const SetNode& other) noexcept
-			: Value(other.Value), Next(other.Next), Status(other.Status)
+			: Value(other.Value)
 		{
 		}
 
 		constexpr SetNode(SetNode&& other) noexcept
-			: Value(std::move(other.Value)), Next(other.Next), Status(other.Status)
+			: Value(std::move(other.Value))
 		{
-			other.Invalidate();
 		}
 
 		explicit constexpr SetNode(const T& value) noexcept
-			: Value(value), Status(MemStatus::Valid)
+			: Value(value)
 		{
 		}
 
 		explicit constexpr SetNode(T&& value) noexcept
-			: Value(std::move(value)), Status(MemStatus::Valid)
+			: Value(std::move(value))
 		{
 		}
 
-		constexpr ~SetNode() noexcept { Invalidate(); }
+		constexpr ~SetNode() noexcept = default;
 
 		// Utility
-		constexpr void Invalidate() noexcept
-		{
-			Next = nullptr;
-			Status = MemStatus::Invalid;
-		}
-
-		constexpr void Dispose() noexcept
-		{
-			Value.~T();
-		}
-
 		NODISCARD constexpr T& GetKey() noexcept { return Value; }
+		NODISCARD constexpr const T& GetKey() const noexcept { return Value; }
 		NODISCARD constexpr T& GetValue() noexcept { return Value; }
+		NODISCARD constexpr const T& GetValue() const noexcept { return Value; }
 		NODISCARD constexpr IteratorType& GetIteratorValue() noexcept { return Value; }
-		NODISCARD constexpr bool IsValid() const noexcept { return Status == MemStatus::Valid; }
+		NODISCARD constexpr const IteratorType& GetIteratorValue() const noexcept { return Value; }
+
+		// Static
+		NODISCARD constexpr static const T& KeyOf(const T& value) noexcept { return value; }
 
 		// Operator Overloads
 		SetNode& operator=(const SetNode& other) noexcept
@@ -68,9 +57,6 @@ namespace Micro
 				return *this;
 
 			Value = other.Value;
-			Next = other.Next;
-			Status = other.Status;
-
 			return *this;
 		}
 
@@ -80,9 +66,6 @@ namespace Micro
 				return *this;
 
 			Value = std::move(other.Value);
-			Next = other.Next;
-			Status = other.Status;
-
 			return *this;
 		}
 	};
@@ -120,6 +103,10 @@ namespace Micro
 		{
 		}
 
+		constexpr explicit Set(const Span<T>& values) noexcept : Base(values)
+		{
+		}
+
 		explicit Set(const size_t capacity) : Base(capacity)
 		{
 		}
@@ -137,6 +124,11 @@ namespace Micro
 			return Base::Insert(std::move(value));
 		}
 
+		size_t InsertRange(const Span<T>& values)
+		{
+			return Base::InsertRange(values.Data(), values.Capacity());
+		}
+
 		bool Remove(const T& value)
 		{
 			return Base::Erase(value);
@@ -147,21 +139,11 @@ namespace Micro
 			if (Base::IsEmpty())
 				return false;
 
-			auto metaData = other.m_MetaData;
-			while (metaData != nullptr)
-			{
-				auto bucket = metaData->BucketReference;
-				while (bucket != nullptr && bucket->IsValid())
-				{
-					if (Contains(bucket->Value))
-						return true;
-
-					bucket = bucket->Next;
-				}
+			for (size_t i = 0; i < other.m_Size; i++)
+				if (Contains(other.NodeAt(i).Value))
+					return true;
 
-				metaData = metaData->Next;
-			}
-			return true;
+			return false;
 		}
 
 		NODISCARD bool SetEquals(const Set& other) const
@@ -169,110 +151,55 @@ namespace Micro
 			if (Base::m_Size != other.m_Size)
 				return false;
 
-			auto metaData = other.m_MetaData;
-			while (metaData != nullptr)
-			{
-				auto bucket = metaData->BucketReference;
-				while (bucket != nullptr && bucket->IsValid())
-				{
-					if (!Contains(bucket->Value))
-						return false;
-
-					bucket = bucket->Next;
-				}
+			for (size_t i = 0; i < other.m_Size; i++)
+				if (!Contains(other.NodeAt(i).Value))
+					return false;
 
-				metaData = metaData->Next;
-			}
 			return true;
 		}
 
 		NODISCARD bool Contains(const T& value) const noexcept
 		{
-			// Get hash of bucket
-			auto bucket = &Base::m_Data[Hash(value) % Base::m_Capacity];
-			if (!bucket->IsValid())
-				return false;
-
-			// Loop through bucket for matching value
-			while (bucket != nullptr)
-			{
-				if (bucket->Value == value)
-					return true;
-
-				bucket = bucket->Next;
-			}
+			return Base::FindNode(value) != nullptr;
+		}
 
-			return false;
+		/// <summary>
+		/// Checks for an element equal to the lookup value (e.g. a StringBuffer or char pointer for String
+		/// elements), without converting the lookup value to an element.
+		/// </summary>
+		template <TransparentKey<T> TLookup>
+		NODISCARD bool Contains(const TLookup& value) const noexcept
+		{
+			return Base::FindNode(value) != nullptr;
 		}
 
 		void IntersectWith(const Set& other)
 		{
-			auto metaData = Base::m_MetaData;
-			while (metaData != nullptr)
+			// Walk backwards, since removal swaps the last occupied slot into the removed position
+			for (size_t i = Base::m_Size; i > 0; i--)
 			{
-				const auto next = metaData->Next;
-				auto bucket = metaData->BucketReference;
-				while (bucket != nullptr && bucket->IsValid())
-				{
-					const auto nextNode = bucket->Next;
-					const auto& value = bucket->Value;
-					if (!other.Contains(value))
-						Remove(value);
-
-					bucket = nextNode;
-				}
-
-				metaData = next;
+				const auto& value = Base::NodeAt(i - 1).Value;
+				if (!other.Contains(value))
+					Remove(value);
 			}
 		}
 
 		void UnionWith(const Set& other)
 		{
-			auto metaData = other.m_MetaData;
-			while (metaData != nullptr)
-			{
-				auto bucket = metaData->BucketReference;
-				while (bucket != nullptr && bucket->IsValid())
-				{
-					Add(bucket->Value);
-					bucket = bucket->Next;
-				}
-
-				metaData = metaData->Next;
-			}
+			for (size_t i = 0; i < other.m_Size; i++)
+				Add(other.NodeAt(i).Value);
 		}
 
 		// Operator Overloads
 		Set& operator=(const Set& other)
 		{
-			if (this == &other)
-				return *this;
-
-			Base::Clear();
-
-			Base::CopyFrom(other);
-
+			Base::operator=(other);
 			return *this;
 		}
 
 		Set& operator=(Set&& other) noexcept
 		{
-			if (this == &other)
-				return *this;
-
-			Base::Clear();
-
-			Base::m_Data = other.m_Data;
-			Base::m_MetaData = other.m_MetaData;
-			Base::m_Capacity = other.m_Capacity;
-			Base::m_Size = other.m_Size;
-			Base::m_LoadFactor = other.m_LoadFactor;
-
-			other.m_Data = nullptr;
-			other.m_MetaData = nullptr;
-			other.m_Capacity = 0;
-			other.m_Size = 0;
-			other.m_LoadFactor = 0;
+			Base::operator=(std::move(other));
 			return *this;
 		}
 	};
@@ -0,0 +1,244 @@
+#pragma once
+#include <atomic>
+#include <bit>
+
+#include "Common/Span.hpp"
+#include "Core/Core.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Utility/Options/Optional.hpp"
+
+namespace Micro
+{
+	/**
+	 * \brief Lock-free bounded queue for exactly one producer thread and one consumer thread. Elements live in a ring
+	 *		  inside the object; the producer only writes the tail and the consumer only writes the head, each on its own
+	 *		  cache line, and they hand elements over with release/acquire ordering. Each side also keeps a cached copy
+	 *		  of the other side's index, so it only reads the shared one when the ring looks full (or empty).
+	 *		  Enqueue functions must only be called from the producer, dequeue functions only from the consumer.
+	 * \tparam T Type of elements in queue
+	 * \tparam TCapacity Maximum number of elements (power of two)
+	 */
+	template <typename T, size_t TCapacity>
+	class SpscQueue final
+	{
+		static_assert(std::has_single_bit(TCapacity), "Capacity must be a power of two.");
+
+	public:
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		SpscQueue() noexcept = default;
+
+		// Both threads refer to the queue by address
+		SpscQueue(const SpscQueue&) = delete;
+		SpscQueue(SpscQueue&&) = delete;
+
+		/// <summary>
+		/// Destroys the elements that were never dequeued. No thread may use the queue anymore.
+		/// </summary>
+		~SpscQueue() noexcept
+		{
+			const size_t tail = m_Tail.load(std::memory_order_relaxed);
+			for (size_t head = m_Head.load(std::memory_order_relaxed); head != tail; head++)
+				Slot(head).~T();
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD constexpr static size_t Capacity() noexcept { return TCapacity; }
+
+		/// <summary>
+		/// Number of elements, which is only a snapshot while the other thread is running.
+		/// </summary>
+		NODISCARD size_t Size() const noexcept
+		{
+			const size_t head = m_Head.load(std::memory_order_acquire);
+			return m_Tail.load(std::memory_order_acquire) - head;
+		}
+
+		NODISCARD bool IsEmpty() const noexcept { return Size() == 0; }
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Producer                         |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Enqueues a copy of the value, unless the queue is full.
+		/// </summary>
+		/// <returns>True, if enqueued</returns>
+		NODISCARD bool TryEnqueue(const T& value) noexcept { return TryEmplace(value); }
+
+		/// <summary>
+		/// Enqueues the value by move, unless the queue is full (the value is left untouched then).
+		/// </summary>
+		/// <returns>True, if enqueued</returns>
+		NODISCARD bool TryEnqueue(T&& value) noexcept { return TryEmplace(std::move(value)); }
+
+		/// <summary>
+		/// Creates the value in the next free slot, unless the queue is full.
+		/// </summary>
+		/// <returns>True, if enqueued</returns>
+		template <typename... Args>
+		NODISCARD bool TryEmplace(Args&&... args) noexcept
+		{
+			const size_t tail = m_Tail.load(std::memory_order_relaxed);
+			if (tail - m_CachedHead == TCapacity)
+			{
+				m_CachedHead = m_Head.load(std::memory_order_acquire);
+				if (tail - m_CachedHead == TCapacity)
+					return false;
+			}
+
+			new(&Slot(tail)) T(std::forward<Args>(args)...);
+			m_Tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		/// <summary>
+		/// Enqueues copies of as many elements of the span as fit, in order, and publishes them all at once.
+		/// </summary>
+		/// <param name="span">Elements to enqueue</param>
+		/// <returns>Number of elements enqueued (from the start of the span)</returns>
+		NODISCARD size_t TryEnqueue(const Span<T>& span) noexcept
+		{
+			const size_t tail = m_Tail.load(std::memory_order_relaxed);
+			size_t count = MIN(span.Capacity(), TCapacity - (tail - m_CachedHead));
+			if (count < span.Capacity())
+			{
+				m_CachedHead = m_Head.load(std::memory_order_acquire);
+				count = MIN(span.Capacity(), TCapacity - (tail - m_CachedHead));
+			}
+
+			const T* data = span.Data();
+			for (size_t i = 0; i < count; i++)
+				new(&Slot(tail + i)) T(data[i]);
+
+			if (count != 0)
+				m_Tail.store(tail + count, std::memory_order_release);
+			return count;
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Consumer                         |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Dequeues the oldest element, unless the queue is empty.
+		/// </summary>
+		/// <returns>Oldest element, or an empty optional</returns>
+		NODISCARD Optional<T> TryDequeue() noexcept
+		{
+			const size_t head = m_Head.load(std::memory_order_relaxed);
+			if (head == m_CachedTail)
+			{
+				m_CachedTail = m_Tail.load(std::memory_order_acquire);
+				if (head == m_CachedTail)
+					return Optional<T>::Empty();
+			}
+
+			T& slot = Slot(head);
+			Optional<T> value(std::move(slot));
+			slot.~T();
+
+			m_Head.store(head + 1, std::memory_order_release);
+			return value;
+		}
+
+		/// <summary>
+		/// Moves as many elements as are available (up to the span's capacity) into the span, oldest first, and frees
+		/// their slots all at once. The span's elements are assigned to, so they must be constructed.
+		/// </summary>
+		/// <param name="destination">Span to fill</param>
+		/// <returns>Number of elements dequeued (into the start of the span)</returns>
+		NODISCARD size_t TryDequeue(const Span<T>& destination) noexcept
+		{
+			const size_t head = m_Head.load(std::memory_order_relaxed);
+			size_t count = MIN(destination.Capacity(), m_CachedTail - head);
+			if (count < destination.Capacity())
+			{
+				m_CachedTail = m_Tail.load(std::memory_order_acquire);
+				count = MIN(destination.Capacity(), m_CachedTail - head);
+			}
+
+			T* data = const_cast<T*>(destination.Data());
+			for (size_t i = 0; i < count; i++)
+			{
+				T& slot = Slot(head + i);
+				data[i] = std::move(slot);
+				slot.~T();
+			}
+
+			if (count != 0)
+				m_Head.store(head + count, std::memory_order_release);
+			return count;
+		}
+
+		/// <summary>
+		/// Gets the oldest element without dequeuing it. Only valid until the consumer dequeues it.
+		/// </summary>
+		/// <returns>Pointer to the oldest element, or null if the queue is empty</returns>
+		NODISCARD T* Peek() noexcept
+		{
+			const size_t head = m_Head.load(std::memory_order_relaxed);
+			if (head == m_CachedTail)
+			{
+				m_CachedTail = m_Tail.load(std::memory_order_acquire);
+				if (head == m_CachedTail)
+					return nullptr;
+			}
+
+			return &Slot(head);
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		SpscQueue& operator=(const SpscQueue&) = delete;
+		SpscQueue& operator=(SpscQueue&&) = delete;
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		// Indices only ever increase; the slot is the index modulo the capacity
+		NODISCARD T& Slot(const size_t index) noexcept { return m_Storage.Data()[index & (TCapacity - 1)]; }
+
+	private:
+		// Written by the consumer
+		alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_Head = 0;
+		size_t m_CachedTail = 0;
+
+		// Written by the producer
+		alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_Tail = 0;
+		size_t m_CachedHead = 0;
+
+		alignas(CACHE_LINE_SIZE) UninitializedStorage<T, TCapacity> m_Storage;
+	};
+}
@@ -5,8 +5,8 @@
 
 namespace Micro
 {
-	template <typename T>
-	class Stack final : public HeapCollection<T>
+	template <typename T, CollectionAllocator<T> TAllocator = Allocator<T>, GrowthPolicy TGrowth = DoublingGrowth>
+	class Stack final : public HeapCollection<T, TAllocator, TGrowth>
 	{
 	public:
 		/*
@@ -16,7 +16,7 @@ namespace Micro
 		 */
 
 
-		using Base = HeapCollection<T>;
+		using Base = HeapCollection<T, TAllocator, TGrowth>;
 
 
 		/*
@@ -63,6 +63,14 @@ namespace Micro
 		{
 		}
 
+		constexpr explicit Stack(const TAllocator& allocator) noexcept : Base(allocator)
+		{
+		}
+
+		constexpr Stack(const size_t capacity, const TAllocator& allocator) noexcept : Base(capacity, allocator)
+		{
+		}
+
 		constexpr ~Stack() noexcept override = default;
 
 
@@ -78,9 +86,12 @@ namespace Micro
 			if (!Base::m_Data.IsValidMemory())
 				Base::Allocate(DefaultCapacity);
 			else if (Base::m_Capacity <= Base::m_Size)
-				Base::Reallocate(Base::m_Capacity * 2);
+			{
+				Base::GrowAndEmplace(value);
+				return;
+			}
 
-			Base::m_Data[Base::m_Size++] = value;
+			new(&Base::m_Data[Base::m_Size++]) T(value);
 		}
 
 		constexpr void Push(T&& value) noexcept
@@ -88,9 +99,12 @@ namespace Micro
 			if (!Base::m_Data.IsValidMemory())
 				Base::Allocate(DefaultCapacity);
 			else if (Base::m_Capacity <= Base::m_Size)
-				Base::Reallocate(Base::m_Capacity * 2);
+			{
+				Base::GrowAndEmplace(std::move(value));
+				return;
+			}
 
-			Base::m_Data[Base::m_Size++] = std::move(value);
+			new(&Base::m_Data[Base::m_Size++]) T(std::move(value));
 		}
 
 		template <typename... Args>
@@ -99,7 +113,7 @@ namespace Micro
 			if (!Base::m_Data.IsValidMemory())
 				Base::Allocate(DefaultCapacity);
 			else if (Base::m_Capacity <= Base::m_Size)
-				Base::Reallocate(Base::m_Capacity * 2);
+				return Base::GrowAndEmplace(std::forward<Args>(args)...);
 
 			new(&Base::m_Data[Base::m_Size]) T(std::forward<Args>(args)...);
 			return Base::m_Data[Base::m_Size++];
@@ -197,24 +211,7 @@ namespace Micro
 
 		constexpr Stack& operator=(const Stack& stack) noexcept
 		{
-			// Validation
-			if (this == &stack)
-				return *this;
-
-			const size_t capacity = stack.m_Capacity;
-			if (capacity == 0)
-				return *this;
-
-			// Allocation
-			if (!Base::IsEmpty())
-				Base::Reallocate(capacity);
-			else
-				Base::Allocate(capacity);
-
-			Base::m_Size = stack.m_Size;
-
-			// Assignment
-			Base::CopyFrom(stack);
+			Base::operator=(stack);
 			return *this;
 		}
 
@@ -224,9 +221,9 @@ namespace Micro
 			if (this == &stack)
 				return *this;
 
-			if (!Base::IsEmpty())
-				Base::Clear();
+			Base::Release();
 
+			Base::m_Allocator = std::move(stack.m_Allocator);
 			Base::m_Data = stack.m_Data;
 			Base::m_Size = stack.m_Size;
 			Base::m_Capacity = stack.m_Capacity;
@@ -0,0 +1,332 @@
+#pragma once
+#include <bit>
+#include <concepts>
+#include <type_traits>
+
+#include "Core/Hash.hpp"
+#include "Core/Errors/Error.hpp"
+#include "Common/String.hpp"
+#include "Utility/Tuple.hpp"
+#include "Utility/Options/Optional.hpp"
+
+namespace Micro
+{
+	namespace Internal
+	{
+		// Neither function is constexpr on purpose: reaching one while a StaticMap is built at compile time stops
+		// compilation, and the compiler error names the problem.
+		inline void StaticMapDuplicateKey() noexcept {}
+		inline void StaticMapNoPerfectHash() noexcept {}
+
+		/* Bytes of the String-like lookup types accepted by StaticMaps with 'const char*' keys */
+
+		NODISCARD constexpr Tuple<const char*, size_t> StaticKeyBytes(const char* key) noexcept
+		{
+			return { key, GetLength(key) };
+		}
+
+		NODISCARD constexpr Tuple<const char*, size_t> StaticKeyBytes(const CharSequence auto& key) noexcept
+		{
+			return { key.Data(), key.Length() };
+		}
+
+		NODISCARD constexpr Tuple<const char*, size_t> StaticKeyBytes(const StdCharSequence auto& key) noexcept
+		{
+			return { key.data(), key.size() };
+		}
+
+		NODISCARD constexpr bool BytesEqual(const char* left, const char* right, const size_t length) noexcept
+		{
+			for (size_t i = 0; i < length; i++)
+			{
+				if (left[i] != right[i])
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+	template <typename T>
+	concept StaticMapKey = std::same_as<T, const char*> || std::integral<T> || std::is_enum_v<T>;
+
+	/**
+	 * \brief Immutable map whose keys are known at compile time. Construction runs during constant evaluation and
+	 *		  finds a perfect hash (hash-and-displace: every bucket of keys gets its own seed that sends its keys to
+	 *		  free slots), so the finished table has no collisions and costs nothing at runtime. A lookup hashes
+	 *		  the key once, reads its bucket's seed, and compares exactly one slot.
+	 * \tparam TKey Key type ('const char*' for string keys, or an integral/enum type)
+	 * \tparam TValue Value type (default constructible, to fill the empty slots)
+	 * \tparam TSize Number of pairs
+	 */
+	template <StaticMapKey TKey, typename TValue, size_t TSize>
+	class StaticMap final
+	{
+		static_assert(TSize > 0, "A StaticMap needs at least one pair.");
+
+	public:
+		/*
+		 *  ============================================================
+		 *	|                          Aliases                         |
+		 *  ============================================================
+		 */
+
+
+		using KeyValuePair = Tuple<TKey, TValue>;
+
+
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Builds the perfect hash. Only callable during constant evaluation, so a duplicate key (or, in theory,
+		/// a key set that no seed can separate) is a compile error instead of a runtime one.
+		/// </summary>
+		/// <param name="pairs">Pairs to store</param>
+		consteval explicit StaticMap(const KeyValuePair (&pairs)[TSize])
+		{
+			u64 hashes[TSize]{};
+			size_t bucketStarts[BucketCount + 1]{};
+			for (size_t i = 0; i < TSize; i++)
+			{
+				hashes[i] = KeyHash(pairs[i].Component1);
+				++bucketStarts[(hashes[i] & (BucketCount - 1)) + 1];
+			}
+
+			// Group the pair indices by bucket (counting sort), so each bucket's members are contiguous
+			size_t largestBucket = 0;
+			for (size_t bucket = 0; bucket < BucketCount; bucket++)
+			{
+				largestBucket = MAX(largestBucket, bucketStarts[bucket + 1]);
+				bucketStarts[bucket + 1] += bucketStarts[bucket];
+			}
+
+			size_t members[TSize]{};
+			size_t slots[TSize]{};
+			size_t bucketFill[BucketCount]{};
+			for (size_t i = 0; i < TSize; i++)
+			{
+				const size_t bucket = hashes[i] & (BucketCount - 1);
+				members[bucketStarts[bucket] + bucketFill[bucket]++] = i;
+			}
+
+			// Place the largest buckets first, while most slots are still free
+			for (size_t bucketSize = largestBucket; bucketSize > 0; bucketSize--)
+			{
+				for (size_t bucket = 0; bucket < BucketCount; bucket++)
+				{
+					if (bucketStarts[bucket + 1] - bucketStarts[bucket] == bucketSize)
+						PlaceBucket(pairs, hashes, members + bucketStarts[bucket], bucketSize, bucket, slots);
+				}
+			}
+		}
+
+		constexpr StaticMap(const StaticMap&) noexcept = default;
+		constexpr StaticMap(StaticMap&&) noexcept = default;
+		constexpr ~StaticMap() noexcept = default;
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		template <typename TLookup>
+		NODISCARD constexpr Optional<const TValue&> Find(const TLookup& key) const noexcept
+		{
+			if (const KeyValuePair* pair = FindPair(key))
+				return Optional<const TValue&>(pair->Component2);
+
+			return Optional<const TValue&>::Empty();
+		}
+
+		template <typename TLookup>
+		NODISCARD constexpr bool ContainsKey(const TLookup& key) const noexcept
+		{
+			return FindPair(key) != nullptr;
+		}
+
+		template <typename TLookup>
+		NODISCARD constexpr bool TryGetValue(const TLookup& key, TValue& out) const noexcept
+		{
+			const KeyValuePair* pair = FindPair(key);
+			if (pair == nullptr)
+				return false;
+
+			out = pair->Component2;
+			return true;
+		}
+
+		NODISCARD constexpr static size_t Size() noexcept { return TSize; }
+		NODISCARD constexpr static size_t Capacity() noexcept { return SlotCount; }
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		template <typename TLookup>
+		NODISCARD constexpr const TValue& operator[](const TLookup& key) const
+		{
+			if (const KeyValuePair* pair = FindPair(key))
+				return pair->Component2;
+
+			throw KeyNotFoundError("Key could not be found in the StaticMap.", NAMEOF(key));
+		}
+
+		constexpr StaticMap& operator=(const StaticMap&) noexcept = default;
+		constexpr StaticMap& operator=(StaticMap&&) noexcept = default;
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		struct Slot
+		{
+			KeyValuePair Pair{};
+			size_t KeyLength = 0;
+			bool IsUsed = false;
+		};
+
+		constexpr static bool IsStringKey = std::same_as<TKey, const char*>;
+
+		/// <summary>
+		/// Gets the pair of the key. String maps accept char pointers and any String-like object, other maps
+		/// anything convertible to the key type.
+		/// </summary>
+		template <typename TLookup>
+		NODISCARD constexpr const KeyValuePair* FindPair(const TLookup& key) const noexcept
+		{
+			if constexpr (IsStringKey)
+			{
+				const auto [data, length] = Internal::StaticKeyBytes(key);
+				const Slot& slot = m_Slots[SlotOf(HashBytes(data, length))];
+				if (slot.IsUsed && slot.KeyLength == length && Internal::BytesEqual(slot.Pair.Component1, data, length))
+					return &slot.Pair;
+			}
+			else
+			{
+				const TKey lookup = static_cast<TKey>(key);
+				const Slot& slot = m_Slots[SlotOf(KeyHash(lookup))];
+				if (slot.IsUsed && slot.Pair.Component1 == lookup)
+					return &slot.Pair;
+			}
+
+			return nullptr;
+		}
+
+		NODISCARD constexpr size_t SlotOf(const u64 hash) const noexcept
+		{
+			return SlotOf(hash, m_Seeds[hash & (BucketCount - 1)]);
+		}
+
+		NODISCARD constexpr static size_t SlotOf(const u64 hash, const u32 seed) noexcept
+		{
+			return HashInteger(hash, seed) & (SlotCount - 1);
+		}
+
+		NODISCARD constexpr static u64 KeyHash(const TKey& key) noexcept
+		{
+			if constexpr (IsStringKey)
+				return HashBytes(key, GetLength(key));
+			else
+				return HashInteger(static_cast<u64>(key));
+		}
+
+		NODISCARD constexpr static bool KeysEqual(const TKey& left, const TKey& right) noexcept
+		{
+			if constexpr (IsStringKey)
+			{
+				const size_t length = GetLength(left);
+				return length == GetLength(right) && Internal::BytesEqual(left, right, length);
+			}
+			else
+				return left == right;
+		}
+
+		/// <summary>
+		/// Tries seeds until every key of the bucket lands in a distinct free slot, then stores the pairs there.
+		/// 'slots' is scratch space with room for every key of the bucket.
+		/// </summary>
+		consteval void PlaceBucket(const KeyValuePair (&pairs)[TSize], const u64 (&hashes)[TSize], const size_t* members,
+		                           const size_t count, const size_t bucket, size_t* slots)
+		{
+			// Keys sharing a full hash can never be separated by a seed, so only they need comparing
+			for (size_t i = 0; i < count; i++)
+			{
+				for (size_t j = 0; j < i; j++)
+				{
+					if (hashes[members[i]] != hashes[members[j]])
+						continue;
+
+					if (KeysEqual(pairs[members[i]].Component1, pairs[members[j]].Component1))
+						Internal::StaticMapDuplicateKey();
+					Internal::StaticMapNoPerfectHash();
+				}
+			}
+
+			for (u32 seed = 1; seed <= MaxSeed; seed++)
+			{
+				bool isFree = true;
+				for (size_t i = 0; i < count && isFree; i++)
+				{
+					slots[i] = SlotOf(hashes[members[i]], seed);
+					isFree = !m_Slots[slots[i]].IsUsed;
+
+					for (size_t j = 0; j < i && isFree; j++)
+						isFree = slots[j] != slots[i];
+				}
+
+				if (!isFree)
+					continue;
+
+				for (size_t i = 0; i < count; i++)
+				{
+					Slot& slot = m_Slots[slots[i]];
+					slot.Pair = pairs[members[i]];
+					slot.IsUsed = true;
+					if constexpr (IsStringKey)
+						slot.KeyLength = GetLength(slot.Pair.Component1);
+				}
+
+				m_Seeds[bucket] = seed;
+				return;
+			}
+
+			Internal::StaticMapNoPerfectHash();
+		}
+
+	private:
+		// Slots stay at most 3/4 full, so buckets find free slots after a few seeds
+		constexpr static size_t SlotCount = std::bit_ceil(TSize) * (TSize * 4 > std::bit_ceil(TSize) * 3 ? 2 : 1);
+		constexpr static size_t BucketCount = std::bit_ceil(TSize);
+		constexpr static u32 MaxSeed = 1u << 16;
+
+	private:
+		Slot m_Slots[SlotCount]{};
+		u32 m_Seeds[BucketCount]{};
+	};
+
+	/// <summary>
+	/// Builds a StaticMap at compile time, deducing the number of pairs.
+	/// </summary>
+	/// <example>constexpr auto keywords = MakeStaticMap&lt;const char*, int&gt;({ { "if", 1 }, { "else", 2 } });</example>
+	template <StaticMapKey TKey, typename TValue, size_t TSize>
+	NODISCARD consteval StaticMap<TKey, TValue, TSize> MakeStaticMap(const Tuple<TKey, TValue> (&pairs)[TSize])
+	{
+		return StaticMap<TKey, TValue, TSize>(pairs);
+	}
+}
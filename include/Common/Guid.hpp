@@ -91,11 +91,6 @@ namespace Micro
 	template <>
 	NODISCARD inline size_t Hash(const Guid& guid) noexcept 
 	{
-		const auto data = guid.Data();
-		auto hash = 0;
-		for (size_t i = 0; i < 36; i++)
-			hash += data[i];
-
-		return typeid(Guid).hash_code() + hash; 
+		return HashBytes(guid.Data(), 36);
 	}
 }
@@ -301,7 +301,12 @@ namespace Micro
 	template <typename T>
 	NODISCARD size_t Hash(const Span<T>& object) noexcept
 	{
-		return typeid(T).hash_code() + typeid(Span<T>).hash_code() + object.Capacity();
+		const T* data = object.Data();
+		size_t hash = HashInteger(object.Capacity());
+		for (size_t i = 0; i < object.Capacity(); i++)
+			hash = HashCombine(hash, Hash(data[i]));
+
+		return hash;
 	}
 
 	template <typename T>
@@ -1,5 +1,10 @@
 #pragma once
+#include <compare>
+#include <cstring>
+
 #include "Core/Hash.hpp"
+#include "Core/Memory/Arena.hpp"
+#include "Core/Memory/GrowthPolicy.hpp"
 #include "Collections/Base/Enumerable.hpp"
 #include "Utility/Options/Optional.hpp"
 #include "Internal/StringInternals.hpp"
@@ -77,6 +82,48 @@ namespace Micro
 		{
 		}
 
+		/**
+		 * \brief Initializes a new empty instance of the String class whose buffer will be allocated from the arena.
+		 *		  The String must not outlive the arena (or a rewind past its allocations); copies go to the global heap.
+		 * \param arena Arena to allocate from
+		 */
+		constexpr explicit String(Arena& arena) noexcept
+			: m_Arena(&arena)
+		{
+		}
+
+		/**
+		 * \brief Initializes a new instance of the String class by copying the value of the char pointer into the arena.
+		 * \param string Null-terminated char pointer to copy
+		 * \param arena Arena to allocate from
+		 */
+		constexpr String(const char* string, Arena& arena) noexcept
+			: m_Arena(&arena)
+		{
+			const size_t length = GetLength(string);
+			if (length == 0)
+				return;
+
+			Allocate(length);
+			InternalCopy(string, length);
+		}
+
+		/**
+		 * \brief Initializes a new instance of the String class by copying the value of the String-like argument into the arena.
+		 * \param string String-like object to copy
+		 * \param arena Arena to allocate from
+		 */
+		constexpr String(const CharSequence auto& string, Arena& arena) noexcept
+			: m_Arena(&arena)
+		{
+			const size_t length = string.Length();
+			if (length == 0)
+				return;
+
+			Allocate(length);
+			InternalCopy(string.Data(), length);
+		}
+
 		/**
 		 * \brief Initializes a new instance of the String class by copying the value of the String argument.
 		 * \param string String to copy
@@ -93,10 +140,11 @@ namespace Micro
 		 * \param string String to move
 		 */
 		constexpr String(String&& string) noexcept
-			: m_Data(std::move(string.m_Data)), m_Size(string.m_Size)
+			: m_Data(std::move(string.m_Data)), m_Size(string.m_Size), m_Capacity(string.m_Capacity), m_Arena(string.m_Arena)
 		{
 			string.m_Data = nullptr;
 			string.m_Size = 0;
+			string.m_Capacity = 0;
 		}
 
 		/**
@@ -216,10 +264,11 @@ namespace Micro
 		 */
 		constexpr ~String() noexcept override
 		{
-			delete[] m_Data.Data;
+			FreeBlock();
 
 			m_Data = nullptr;
 			m_Size = 0;
+			m_Capacity = 0;
 		}
 
 
@@ -242,6 +291,12 @@ namespace Micro
 		/// <returns>Length of type 'size_t'</returns>
 		NODISCARD constexpr size_t Length() const noexcept { return m_Size; }
 
+		/// <summary>
+		/// Number of characters the underlying buffer holds before appending reallocates (excluding null termination).
+		/// </summary>
+		/// <returns>Capacity of the buffer</returns>
+		NODISCARD constexpr size_t Capacity() const noexcept { return m_Capacity; }
+
 		/// <summary>
 		/// Represents the underlying char buffer (const version).
 		/// </summary>
@@ -303,17 +358,7 @@ namespace Micro
 			if (length == 0)
 				return *this;
 
-			if (m_Data == nullptr)
-			{
-				Allocate(length);
-				InternalCopy(string.Data(), length);
-			}
-			else
-			{
-				const size_t startIndex = m_Size;
-				Reallocate(m_Size + length);
-				InternalConcat(startIndex, string.Data(), string.Length());
-			}
+			InternalAppend(string.Data(), length);
 
 			return *this;
 		}
@@ -330,17 +375,7 @@ namespace Micro
 			if (length == 0)
 				return *this;
 
-			if (m_Data == nullptr)
-			{
-				Allocate(length);
-				InternalCopy(string.data(), length);
-			}
-			else
-			{
-				const size_t startIndex = m_Size;
-				Reallocate(m_Size + length);
-				InternalConcat(startIndex, string.data(), string.size());
-			}
+			InternalAppend(string.data(), length);
 
 			return *this;
 		}
@@ -359,17 +394,7 @@ namespace Micro
 			if (length == 0)
 				return *this;
 
-			if (m_Data == nullptr)
-			{
-				Allocate(length);
-				InternalCopy(string, length);
-			}
-			else
-			{
-				const size_t startIndex = m_Size;
-				Reallocate(m_Size + length);
-				InternalConcat(startIndex, string, length);
-			}
+			InternalAppend(string, length);
 
 			return *this;
 		}
@@ -386,17 +411,7 @@ namespace Micro
 			if (length == 0 || !string) 
 				return *this;
 
-			if (m_Data == nullptr)
-			{
-				Allocate(length);
-				InternalCopy(string, length);
-			}
-			else
-			{
-				const size_t startIndex = m_Size;
-				Reallocate(m_Size + length);
-				InternalConcat(startIndex, string, length);
-			}
+			InternalAppend(string, length);
 
 			return *this;
 		}
@@ -408,16 +423,7 @@ namespace Micro
 		/// <returns>Reference of this instance</returns>
 		constexpr String& Append(const char character) noexcept
 		{
-			if (m_Data == nullptr)
-			{
-				Allocate(1);
-				m_Data[0] = character;
-			}
-			else
-			{
-				Reallocate(m_Size + 1);
-				m_Data[m_Size - 1] = character;
-			}
+			InternalAppend(&character, 1);
 
 			return *this;
 		}
@@ -453,7 +459,7 @@ namespace Micro
 
 			const size_t removedSize = m_Size - (rightLength * occurrences);
 			const size_t replacedSize = removedSize + (leftLength * occurrences);
-			const auto data = new char[replacedSize + 1];
+			const auto data = AllocateChars(replacedSize + 1);
 
 			auto result = IndexOf(string);
 			size_t offsetIndex = 0;
@@ -510,7 +516,7 @@ namespace Micro
 
 			const size_t removedSize = m_Size - (rightLength * occurrences);
 			const size_t replacedSize = removedSize + (leftLength * occurrences);
-			const auto data = new char[replacedSize + 1];
+			const auto data = AllocateChars(replacedSize + 1);
 
 			auto result = IndexOf(string);
 			size_t offsetIndex = 0;
@@ -570,7 +576,7 @@ namespace Micro
 
 			const size_t removedSize = m_Size - (rightLength * occurrences);
 			const size_t replacedSize = removedSize + (leftLength * occurrences);
-			const auto data = new char[replacedSize + 1];
+			const auto data = AllocateChars(replacedSize + 1);
 
 			auto result = IndexOf(string);
 			size_t offsetIndex = 0;
@@ -607,7 +613,7 @@ namespace Micro
 			if (IsEmpty())
 				return *this;
 
-			const auto string = new char[m_Size + 1];
+			const auto string = AllocateChars(m_Size + 1);
 			for (size_t i = 0; i < m_Size; ++i)
 			{
 				const char current = m_Data[i];
@@ -876,7 +882,7 @@ namespace Micro
 			if (IsEmpty())
 				return {};
 
-			const auto data = new char[m_Size + 1];
+			const auto data = AllocateChars(m_Size + 1);
 			for (size_t i = 0; i < m_Size; i++)
 			{
 				char character = m_Data[i];
@@ -898,7 +904,7 @@ namespace Micro
 			if (IsEmpty())
 				return {};
 
-			const auto data = new char[m_Size + 1];
+			const auto data = AllocateChars(m_Size + 1);
 			for (size_t i = 0; i < m_Size; i++)
 			{
 				char character = m_Data[i];
@@ -917,14 +923,36 @@ namespace Micro
 		/// <returns>Copy of this instance.</returns>
 		NODISCARD constexpr String ToString() const noexcept { return *this; }
 
+		/// <summary>
+		/// Makes room for the given number of characters, so appending up to it doesn't reallocate. Never shrinks. (Mutates instance)
+		/// </summary>
+		/// <param name="capacity">Number of characters to make room for</param>
+		constexpr void Reserve(const size_t capacity) noexcept
+		{
+			if (capacity > m_Capacity)
+				ReallocateBlock(capacity);
+		}
+
+		/// <summary>
+		/// Reallocates the underlying buffer to fit the characters exactly, freeing it if the string is empty. (Mutates instance)
+		/// </summary>
+		constexpr void ShrinkToFit() noexcept
+		{
+			if (m_Size == 0)
+				Clear();
+			else if (m_Capacity > m_Size)
+				ReallocateBlock(m_Size);
+		}
+
 		/**
 		 * \brief Frees the memory of the underlying char buffer and sets it to null.
 		 */
 		constexpr void Clear() noexcept
 		{
-			delete[] m_Data.Data;
+			FreeBlock();
 			m_Data = nullptr;
 			m_Size = 0;
+			m_Capacity = 0;
 		}
 
 		/// <summary>
@@ -1073,7 +1101,7 @@ namespace Micro
 			if (length == 0)
 				return false;
 
-			const String wrapper = Create(string, length);
+			const String wrapper(string, length);
 			return IndexOf(wrapper).IsValid();
 		}
 
@@ -1789,7 +1817,7 @@ namespace Micro
 		/// <summary>
 		/// Uses the char pointer and length to create a new string without another allocation.
 		/// </summary>
-		/// <param name="data">Char pointer</param>
+		/// <param name="data">Char pointer allocated with 'Alloc&lt;char&gt;(length + 1)', owned by the String afterwards</param>
 		/// <param name="length">Length of char pointer</param>
 		/// <returns>New instance of String with char pointer as the underlying buffer</returns>
 		NODISCARD constexpr static String Create(const char* data, const size_t length) noexcept
@@ -1797,6 +1825,7 @@ namespace Micro
 			String string;
 			string.m_Data = const_cast<char*>(data);
 			string.m_Size = length;
+			string.m_Capacity = length;
 			string.m_Data[length] = 0;
 			return string;
 		}
@@ -1890,9 +1919,12 @@ namespace Micro
 
 			m_Data = string.m_Data;
 			m_Size = string.m_Size;
+			m_Capacity = string.m_Capacity;
+			m_Arena = string.m_Arena;
 
 			string.m_Data = nullptr;
 			string.m_Size = 0;
+			string.m_Capacity = 0;
 
 			return *this;
 		}
@@ -1954,9 +1986,6 @@ namespace Micro
 		constexpr String& operator=(const char(&string)[TSize]) noexcept
 		{
 			constexpr size_t length = TSize - 1;
-			if (length == 0)
-				return *this;
-
 			if (!m_Data.IsValidMemory())
 			{
 				Allocate(length);
@@ -2021,7 +2050,7 @@ namespace Micro
 		/// <param name="string">Raw string literal to append</param>
 		/// <returns>Reference of this instance</returns>
 		template <size_t TSize>
-		constexpr String& operator+=(const char (&string)[TSize]) noexcept { return Append(string, TSize); }
+		constexpr String& operator+=(const char (&string)[TSize]) noexcept { return Append(string); }
 
 		/// <summary>
 		/// Appends the given character to the end of the underlying buffer.
@@ -2046,7 +2075,7 @@ namespace Micro
 			if (rightSize == 0) return left;
 
 			const size_t size = leftSize + rightSize;
-			const auto data = new char[size + 1];
+			const auto data = AllocateChars(size + 1);
 
 			String newString = Create(data, size);
 			newString.InternalCopy(left.m_Data, leftSize);
@@ -2070,7 +2099,7 @@ namespace Micro
 			if (rightSize == 0) return left;
 
 			const size_t size = leftSize + rightSize;
-			const auto data = new char[size + 1];
+			const auto data = AllocateChars(size + 1);
 
 			String newString = Create(data, size);
 			newString.InternalCopy(left.m_Data, leftSize);
@@ -2094,7 +2123,7 @@ namespace Micro
 			if (rightSize == 0) return left;
 
 			const size_t size = leftSize + rightSize;
-			const auto data = new char[size + 1];
+			const auto data = AllocateChars(size + 1);
 
 			String newString = Create(data, size);
 			newString.InternalCopy(left.m_Data, leftSize);
@@ -2119,7 +2148,7 @@ namespace Micro
 			if (rightSize == 0) return left;
 
 			const size_t size = leftSize + rightSize;
-			const auto data = new char[size + 1];
+			const auto data = AllocateChars(size + 1);
 
 			String newString = Create(data, size);
 			newString.InternalCopy(left.m_Data, leftSize);
@@ -2142,7 +2171,7 @@ namespace Micro
 				return String {character};
 
 			const size_t size = leftSize + rightSize;
-			const auto data = new char[size + 1];
+			const auto data = AllocateChars(size + 1);
 
 			String newString = Create(data, size);
 			newString.InternalCopy(left.m_Data, left.m_Size);
@@ -2166,7 +2195,7 @@ namespace Micro
 			if (rightSize == 0) return left;
 
 			const size_t size = leftSize + rightSize;
-			const auto data = new char[size + 1];
+			const auto data = AllocateChars(size + 1);
 
 			String newString = Create(data, size);
 			newString.InternalCopy(left.Data(), leftSize);
@@ -2190,7 +2219,7 @@ namespace Micro
 			if (rightSize == 0) return left;
 
 			const size_t size = leftSize + rightSize;
-			const auto data = new char[size + 1];
+			const auto data = AllocateChars(size + 1);
 
 			String newString = Create(data, size);
 			newString.InternalCopy(left.data(), leftSize);
@@ -2215,7 +2244,7 @@ namespace Micro
 			if (rightSize == 0) return { left, leftSize };
 
 			const size_t size = leftSize + rightSize;
-			const auto data = new char[size + 1];
+			const auto data = AllocateChars(size + 1);
 
 			String newString = Create(data, size);
 			newString.InternalCopy(left, leftSize);
@@ -2238,7 +2267,7 @@ namespace Micro
 				return String{character};
 
 			const size_t size = leftSize + rightSize;
-			const auto data = new char[size + 1];
+			const auto data = AllocateChars(size + 1);
 
 			String newString = Create(data, size);
 			newString.InternalCopy(&character, leftSize);
@@ -2279,6 +2308,14 @@ namespace Micro
 		template <size_t TSize>
 		constexpr friend bool operator==(const String& left, const char(&right)[TSize]) noexcept { return left.Equals(right); }
 
+		/// <summary>
+		/// Tests if the string is equal to the null-terminated char pointer (without constructing a String).
+		/// </summary>
+		/// <param name="left">String to test against</param>
+		/// <param name="right">Null-terminated char pointer to test against</param>
+		/// <returns>True, if equal</returns>
+		constexpr friend bool operator==(const String& left, const char* right) noexcept { return left.Equals(right, GetLength(right)); }
+
 		/// <summary>
 		/// Tests if the string is equal to the character.
 		/// </summary>
@@ -2312,6 +2349,14 @@ namespace Micro
 		template <size_t TSize>
 		constexpr friend bool operator==(const char(&left)[TSize], const String& right) noexcept { return right.Equals(left); }
 
+		/// <summary>
+		/// Tests if the null-terminated char pointer is equal to the string (without constructing a String).
+		/// </summary>
+		/// <param name="left">Null-terminated char pointer to test against</param>
+		/// <param name="right">String to test against</param>
+		/// <returns>True, if equal</returns>
+		constexpr friend bool operator==(const char* left, const String& right) noexcept { return right.Equals(left, GetLength(left)); }
+
 		/// <summary>
 		/// Tests if the character is equal to the string.
 		/// </summary>
@@ -2353,6 +2398,14 @@ namespace Micro
 		template <size_t TSize>
 		constexpr friend bool operator!=(const String& left, const char (&right)[TSize]) noexcept { return !(left == right); }
 
+		/// <summary>
+		/// Tests if the string is not equal to the null-terminated char pointer.
+		/// </summary>
+		/// <param name="left">String to test against</param>
+		/// <param name="right">Null-terminated char pointer to test against</param>
+		/// <returns>True, if not equal</returns>
+		constexpr friend bool operator!=(const String& left, const char* right) noexcept { return !(left == right); }
+
 		/// <summary>
 		/// Tests if the string is not equal to the character.
 		/// </summary>
@@ -2386,6 +2439,14 @@ namespace Micro
 		template <size_t TSize>
 		constexpr friend bool operator!=(const char (&left)[TSize], const String& right) noexcept { return !(left == right); }
 
+		/// <summary>
+		/// Tests if the null-terminated char pointer is not equal to the string.
+		/// </summary>
+		/// <param name="left">Null-terminated char pointer to test against</param>
+		/// <param name="right">String to test against</param>
+		/// <returns>True, if not equal</returns>
+		constexpr friend bool operator!=(const char* left, const String& right) noexcept { return !(left == right); }
+
 		/// <summary>
 		/// Tests if the character is not equal to the string.
 		/// </summary>
@@ -2394,6 +2455,50 @@ namespace Micro
 		/// <returns>True, if not equal</returns>
 		constexpr friend bool operator!=(const char character, const String& right) noexcept { return !(character == right); }
 
+		/// <summary>
+		/// Compares the two strings lexicographically by their bytes. A string that is a prefix of the other orders first.
+		/// </summary>
+		/// <param name="left">String to compare</param>
+		/// <param name="right">String to compare against</param>
+		/// <returns>Ordering of the left string relative to the right one</returns>
+		constexpr friend std::strong_ordering operator<=>(const String& left, const String& right) noexcept
+		{
+			return CompareBytes(left.m_Data, left.m_Size, right.m_Data, right.m_Size);
+		}
+
+		/// <summary>
+		/// Compares the string and the String-like object lexicographically by their bytes.
+		/// </summary>
+		/// <param name="left">String to compare</param>
+		/// <param name="right">String-like object to compare against</param>
+		/// <returns>Ordering of the string relative to the String-like object</returns>
+		constexpr friend std::strong_ordering operator<=>(const String& left, const CharSequence auto& right) noexcept
+		{
+			return CompareBytes(left.m_Data, left.m_Size, right.Data(), right.Length());
+		}
+
+		/// <summary>
+		/// Compares the string and the std String-like object lexicographically by their bytes.
+		/// </summary>
+		/// <param name="left">String to compare</param>
+		/// <param name="right">std String-like object to compare against</param>
+		/// <returns>Ordering of the string relative to the std String-like object</returns>
+		constexpr friend std::strong_ordering operator<=>(const String& left, const StdCharSequence auto& right) noexcept
+		{
+			return CompareBytes(left.m_Data, left.m_Size, right.data(), right.size());
+		}
+
+		/// <summary>
+		/// Compares the string and the null-terminated char pointer lexicographically by their bytes.
+		/// </summary>
+		/// <param name="left">String to compare</param>
+		/// <param name="right">Null-terminated char pointer to compare against</param>
+		/// <returns>Ordering of the string relative to the char pointer</returns>
+		constexpr friend std::strong_ordering operator<=>(const String& left, const char* right) noexcept
+		{
+			return CompareBytes(left.m_Data, left.m_Size, right, GetLength(right));
+		}
+
 		/// <summary>
 		/// Prints the given string out to the console.
 		/// </summary>
@@ -2416,7 +2521,8 @@ namespace Micro
 
 
 		/// <summary>
-		/// Allocates a new block of memory with +1 capacity to account for null termination character.
+		/// Allocates a new block of memory with +1 capacity to account for null termination character, and sizes the
+		/// string to the capacity.
 		/// </summary>
 		/// <param name="capacity">New capacity to allocate with</param>
 		constexpr void Allocate(const size_t capacity) noexcept
@@ -2424,31 +2530,85 @@ namespace Micro
 			if (capacity == 0) return;
 
 			const size_t length = capacity + 1;
-			m_Data = new char[length];
+			m_Data = m_Arena != nullptr ? m_Arena->Allocate<char>(length) : AllocateChars(length);
 			m_Size = capacity;
+			m_Capacity = capacity;
 			m_Data[capacity] = 0;
 		}
 
 		/// <summary>
-		/// Reallocates a new block of memory or calls Allocate if the underlying buffer is null.
+		/// Sizes the string to the given length, reusing the underlying buffer when it is large enough.
+		/// </summary>
+		/// <param name="size">New length of the string</param>
+		constexpr void Reallocate(const size_t size) noexcept
+		{
+			if (size > m_Capacity)
+				ReallocateBlock(size);
+
+			if (m_Data == nullptr)
+				return;
+
+			m_Size = size;
+			m_Data[m_Size] = 0;
+		}
+
+		/// <summary>
+		/// Moves the characters into a buffer with room for the given capacity (+1 for null termination), or allocates
+		/// one if the underlying buffer is null. Characters past the new capacity are cut.
 		/// </summary>
 		/// <param name="capacity">New capacity to allocate with</param>
-		constexpr void Reallocate(const size_t capacity) noexcept
+		constexpr void ReallocateBlock(const size_t capacity) noexcept
 		{
-			if (capacity == 0) return;
 			const size_t length = capacity + 1;
+			if (m_Data == nullptr)
+				m_Data = m_Arena != nullptr ? m_Arena->Allocate<char>(length) : AllocateChars(length);
+			else if (m_Arena != nullptr)
+				m_Data = static_cast<char*>(m_Arena->Reallocate(m_Data, m_Capacity + 1, length, alignof(char)));
+			else
+			{
+				// The block comes from 'operator new', so it can't go through 'realloc'
+				char* data = AllocateChars(length);
+				std::memcpy(data, m_Data, MIN(m_Size, capacity));
+				Delete(m_Data.Data, m_Capacity + 1);
+				m_Data = data;
+			}
+
+			m_Capacity = capacity;
+			m_Size = MIN(m_Size, capacity);
+			m_Data[m_Size] = 0;
+		}
 
-			// Reallocation
-			if (m_Data != nullptr)
+		/// <summary>
+		/// Appends the characters, growing the buffer geometrically so appending in a loop stays amortized O(1).
+		/// The characters may come from this string's own buffer.
+		/// </summary>
+		/// <param name="ptr">Char pointer to append</param>
+		/// <param name="length">Length of char pointer</param>
+		constexpr void InternalAppend(const char* ptr, const size_t length) noexcept
+		{
+			const size_t size = m_Size + length;
+			if (size > m_Capacity)
 			{
-				m_Data = static_cast<char*>(realloc(m_Data, length));
-				m_Size = capacity;
-				m_Data[m_Size] = 0;
-				return;
+				const bool isOwn = m_Data != nullptr && ptr >= m_Data.Data && ptr < m_Data.Data + m_Capacity + 1;
+				const size_t offset = isOwn ? static_cast<size_t>(ptr - m_Data.Data) : 0;
+
+				ReallocateBlock(Growth::Grow(m_Capacity, size, sizeof(char)));
+				if (isOwn)
+					ptr = m_Data.Data + offset;
 			}
 
-			// Allocate initial memory
-			Allocate(capacity);
+			InternalConcat(m_Size, ptr, length);
+			m_Size = size;
+			m_Data[m_Size] = 0;
+		}
+
+		/// <summary>
+		/// Frees the underlying buffer, unless it belongs to an arena (which reclaims it on its own).
+		/// </summary>
+		constexpr void FreeBlock() noexcept
+		{
+			if (m_Arena == nullptr)
+				Delete(m_Data.Data, m_Capacity + 1);
 		}
 
 		/// <summary>
@@ -2458,6 +2618,10 @@ namespace Micro
 		/// <param name="length">Length of char pointer</param>
 		constexpr void InternalCopy(const char* ptr, const size_t length) noexcept
 		{
+			// Copying an empty string allocates nothing
+			if (m_Data == nullptr)
+				return;
+
 			for (size_t i = 0; i < length; i++)
 				new(&m_Data[i]) char(ptr[i]);
 				
@@ -2476,9 +2640,39 @@ namespace Micro
 				new(&m_Data[i + startIndex]) char(ptr[i]);
 		}
 
+		/// <summary>
+		/// Compares two byte sequences lexicographically. A sequence that is a prefix of the other orders first.
+		/// </summary>
+		NODISCARD constexpr static std::strong_ordering CompareBytes(const char* left, const size_t leftLength,
+		                                                             const char* right, const size_t rightLength) noexcept
+		{
+			const size_t length = MIN(leftLength, rightLength);
+			for (size_t i = 0; i < length; i++)
+			{
+				if (left[i] != right[i])
+					return static_cast<u8>(left[i]) <=> static_cast<u8>(right[i]);
+			}
+
+			return leftLength <=> rightLength;
+		}
+
+		/// <summary>
+		/// Allocates a heap block of characters, counted under String when allocation tracking is enabled.
+		/// </summary>
+		NODISCARD constexpr static char* AllocateChars(const size_t length) noexcept
+		{
+			TRACK_ALLOCATION_OWNER(String);
+			return Alloc<char>(length);
+		}
+
 	private:
+		// Appending grows the buffer by 1.5x (or to the required length if above that)
+		using Growth = GeometricGrowth<3, 2>;
+
 		Memory<char> m_Data = nullptr;
 		size_t m_Size = 0;
+		size_t m_Capacity = 0;
+		Arena* m_Arena = nullptr;
 	};
 
 
@@ -2497,15 +2691,58 @@ namespace Micro
 	template <>
 	NODISCARD inline size_t Hash(const String& object) noexcept
 	{
-		const size_t size = object.Length();
-		const auto data = object.Data();
-		size_t hash = 0;
-		for (size_t i = 0; i < size; i++)
-			hash += data[i];
+		return HashBytes(object.Data(), object.Length());
+	}
+
+	/// <summary>
+	/// Hashes any String-like object based on the CharSequence concept specifications. Equal characters hash the
+	/// same as a String, so these objects can be used to look up String keys directly.
+	/// </summary>
+	/// <param name="string">String-like object to hash</param>
+	/// <returns>Hash code as a 'size_t'</returns>
+	NODISCARD constexpr size_t Hash(const CharSequence auto& string) noexcept
+	{
+		return HashBytes(string.Data(), string.Length());
+	}
+
+	/// <summary>
+	/// Hashes any String-like object based on the StdCharSequence concept specifications. Equal characters hash the
+	/// same as a String, so these objects can be used to look up String keys directly.
+	/// </summary>
+	/// <param name="string">String-like object to hash</param>
+	/// <returns>Hash code as a 'size_t'</returns>
+	NODISCARD constexpr size_t Hash(const StdCharSequence auto& string) noexcept
+	{
+		return HashBytes(string.data(), string.size());
+	}
 
-		return typeid(String).hash_code() + size + hash;
+	/// <summary>
+	/// Hashes the characters of a null-terminated char pointer (not the pointer itself), the same way as a String.
+	/// </summary>
+	/// <param name="string">Null-terminated char pointer to hash</param>
+	/// <returns>Hash code as a 'size_t'</returns>
+	NODISCARD constexpr size_t Hash(const char* string) noexcept
+	{
+		return HashBytes(string, GetLength(string));
 	}
 
+	// String keys can be looked up with any String-like object or char pointer, without constructing a String
+	template <CharSequence TLookup>
+	constexpr bool IsTransparentKey<TLookup, String> = true;
+
+	template <StdCharSequence TLookup>
+	constexpr bool IsTransparentKey<TLookup, String> = true;
+
+	template <>
+	constexpr bool IsTransparentKey<const char*, String> = true;
+
+	template <size_t TSize>
+	constexpr bool IsTransparentKey<char[TSize], String> = true;
+
+	// A String only owns a heap (or arena) block through a pointer, so moving its bytes relocates it
+	template <>
+	constexpr bool IsTriviallyRelocatable<String> = true;
+
 
 	/// <summary>
 	/// Converts a signed integer into a String.
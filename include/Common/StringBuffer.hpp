@@ -1460,12 +1460,6 @@ namespace Micro
 	template <>
 	NODISCARD inline size_t Hash(const StringBuffer& object) noexcept
 	{
-		const size_t size = object.Length();
-		const auto data = object.Data();
-		size_t hash = 0;
-		for (size_t i = 0; i < size; i++)
-			hash += data[i];
-
-		return typeid(StringBuffer).hash_code() + size + hash;
+		return HashBytes(object.Data(), object.Length());
 	}
 }
@@ -23,14 +23,24 @@ namespace Micro
 		constexpr StringBuilder() noexcept = default;
 
 		/**
-		 * \brief Initializes a new instance of the StringBuilder class using the given StringBuilder to be copied.
+		 * \brief Initializes a new instance of the StringBuilder class by copying the characters of the given
+		 *		  StringBuilder into a buffer of its own (on the global heap).
 		 */
-		constexpr StringBuilder(const StringBuilder&) noexcept = default;
+		constexpr StringBuilder(const StringBuilder& builder) noexcept
+		{
+			InternalAppend(builder.m_Data, builder.m_Size);
+		}
 
 		/**
 		 * \brief Initializes a new instance of the StringBuilder class using the given StringBuilder to be moved.
 		 */
-		constexpr StringBuilder(StringBuilder&&) noexcept = default;
+		constexpr StringBuilder(StringBuilder&& builder) noexcept
+			: m_Data(builder.m_Data), m_Size(builder.m_Size), m_Capacity(builder.m_Capacity), m_Arena(builder.m_Arena)
+		{
+			builder.m_Data = nullptr;
+			builder.m_Size = 0;
+			builder.m_Capacity = 0;
+		}
 
 		/**
 		 * \brief Initializes a new instance of the StringBuilder class by copying the value of the String-like argument
@@ -39,8 +49,7 @@ namespace Micro
 		 */
 		constexpr explicit StringBuilder(const CharSequence auto& string) noexcept
 		{
-			Allocate(MAX(string.Length(), DefaultCapacity));
-			InternalCopy(string.Data(), string.Length());
+			InternalAppend(string.Data(), string.Length());
 		}
 
 		/**
@@ -50,8 +59,7 @@ namespace Micro
 		 */
 		constexpr explicit StringBuilder(const StdCharSequence auto& string) noexcept
 		{
-			Allocate(MAX(string.size(), DefaultCapacity));
-			InternalCopy(string.data(), string.size());
+			InternalAppend(string.data(), string.size());
 		}
 
 		/**
@@ -61,12 +69,24 @@ namespace Micro
 		 */
 		constexpr explicit StringBuilder(const size_t capacity) noexcept { Allocate(capacity); }
 
+		/**
+		 * \brief Initializes a new instance of the StringBuilder class whose buffer is allocated from the arena, with the
+		 *		  given initial capacity. The builder must not outlive the arena; built Strings are copied to the global heap.
+		 * \param arena Arena to allocate from
+		 * \param capacity Capacity to initialize the underlying buffer with
+		 */
+		constexpr explicit StringBuilder(Arena& arena, const size_t capacity = 0) noexcept
+			: m_Arena(&arena)
+		{
+			Allocate(capacity);
+		}
+
 		/**
 		 * \brief Frees the memory of the underlying char buffer and sets it to null.
 		 */
 		constexpr ~StringBuilder() noexcept override
 		{
-			delete[] m_Data;
+			FreeBlock();
 			m_Data = nullptr;
 			m_Size = 0;
 			m_Capacity = 0;
@@ -159,22 +179,7 @@ namespace Micro
 			if (length == 0) 
 				return *this;
 
-			if (m_Data == nullptr)
-			{
-				Allocate(MAX(length, DefaultCapacity));
-				InternalCopy(string.Data(), length);
-			}
-			else
-			{
-				// Reallocate, if necessary
-				const size_t newSize = m_Size + length;
-				HandleReallocation(newSize);
-
-				// Set new data
-				InternalConcat(m_Size, string.Data(), length);
-			}
-
-			m_Size += length;
+			InternalAppend(string.Data(), length);
 			return *this;
 		}
 
@@ -190,22 +195,7 @@ namespace Micro
 			if (length == 0)
 				return *this;
 
-			if (m_Data == nullptr)
-			{
-				Allocate(MAX(length, DefaultCapacity));
-				InternalCopy(string.data(), length);
-			}
-			else
-			{
-				// Reallocate, if necessary
-				const size_t newSize = m_Size + length;
-				HandleReallocation(newSize);
-
-				// Set new data
-				InternalConcat(m_Size, string.data(), length);
-			}
-
-			m_Size += length;
+			InternalAppend(string.data(), length);
 			return *this;
 		}
 
@@ -223,22 +213,7 @@ namespace Micro
 			if constexpr (length == 0)
 				return *this;
 
-			if (m_Data == nullptr)
-			{
-				Allocate(MAX(length, DefaultCapacity));
-				InternalCopy(string, length);
-			}
-			else
-			{
-				// Reallocate, if necessary
-				const size_t newSize = m_Size + length;
-				HandleReallocation(newSize);
-
-				// Set new data
-				InternalConcat(m_Size, string, length);
-			}
-
-			m_Size += length;
+			InternalAppend(string, length);
 			return *this;
 		}
 
@@ -254,22 +229,7 @@ namespace Micro
 			if (length == 0) 
 				return *this;
 
-			if (m_Data == nullptr)
-			{
-				Allocate(MAX(length, DefaultCapacity));
-				InternalCopy(string, length);
-			}
-			else
-			{
-				// Reallocate, if necessary
-				const size_t newSize = m_Size + length;
-				HandleReallocation(newSize);
-
-				// Set new data
-				InternalConcat(m_Size, string, length);
-			}
-
-			m_Size += length;
+			InternalAppend(string, length);
 			return *this;
 		}
 
@@ -290,23 +250,7 @@ namespace Micro
 		/// <returns>Reference of this instance</returns>
 		constexpr StringBuilder& Append(const char character) noexcept
 		{
-			constexpr size_t length = 1;
-			if (m_Data == nullptr)
-			{
-				Allocate(MAX(length, DefaultCapacity));
-				InternalCopy(&character, length);
-			}
-			else
-			{
-				// Reallocate, if necessary
-				const size_t newSize = m_Size + length;
-				HandleReallocation(newSize);
-
-				// Set new data
-				m_Data[m_Size] = character;
-			}
-
-			m_Size += length;
+			InternalAppend(&character, 1);
 			return *this;
 		}
 
@@ -330,93 +274,43 @@ namespace Micro
 		/// <returns>Reference of this instance</returns>
 		constexpr StringBuilder& AppendLine() noexcept
 		{
-			constexpr size_t length = 1;
-			if (m_Data == nullptr)
-			{
-				Allocate(MAX(length, DefaultCapacity));
-				InternalCopy("\n", length);
-			}
-			else
-			{
-				// Reallocate, if necessary
-				const size_t newSize = m_Size + length;
-				HandleReallocation(newSize);
-
-				// Set new data
-				InternalConcat(m_Size, "\n", length);
-			}
-
-			m_Size += length;
+			InternalAppend("\n", 1);
 			return *this;
 		}
 
 		/// <summary>
 		/// Adds the String-like argument that is based on the CharSequence concept specifications to the
-		/// end of the char buffer with a new line. If argument is empty, it will return with no allocations.
+		/// end of the char buffer with a new line. If argument is empty, only the new line is added.
 		/// </summary>
 		/// <param name="string">String-like object to append</param>
 		/// <returns>Reference of this instance</returns>
 		constexpr StringBuilder& AppendLine(const CharSequence auto& string) noexcept
 		{
-			const size_t length = string.Length() + 1;
-			if (length == 0)
-				return *this;
-
-			if (m_Data == nullptr)
-			{
-				Allocate(MAX(length, DefaultCapacity));
-				InternalCopy(string.Data(), length - 1);
-			}
-			else
-			{
-				// Reallocate, if necessary
-				const size_t newSize = m_Size + length;
-				HandleReallocation(newSize);
-
-				// Set new data
-				InternalConcat(m_Size, string.Data(), length - 1);
-			}
+			const size_t length = string.Length();
+			HandleReallocation(m_Size + length + 1);
 
-			InternalConcat(m_Size + length - 1, "\n", 1);
-			m_Size += length;
-			return *this;
+			InternalAppend(string.Data(), length);
+			return AppendLine();
 		}
 
 		/// <summary>
 		/// Adds the String-like argument that is based on the StdCharSequence concept specifications to the
-		/// end of the char buffer with a new line. If argument is empty, it will return with no allocations.
+		/// end of the char buffer with a new line. If argument is empty, only the new line is added.
 		/// </summary>
 		/// <param name="string">String-like object to append</param>
 		/// <returns>Reference of this instance</returns>
 		constexpr StringBuilder& AppendLine(const StdCharSequence auto& string) noexcept
 		{
-			const size_t length = string.size() + 1;
-			if (length == 0)
-				return *this;
-
-			if (m_Data == nullptr)
-			{
-				Allocate(MAX(length, DefaultCapacity));
-				InternalCopy(string.data(), length - 1);
-			}
-			else
-			{
-				// Reallocate, if necessary
-				const size_t newSize = m_Size + length;
-				HandleReallocation(newSize);
-
-				// Set new data
-				InternalConcat(m_Size, string.data(), length - 1);
-			}
+			const size_t length = string.size();
+			HandleReallocation(m_Size + length + 1);
 
-			InternalConcat(m_Size + length - 1, "\n", 1);
-			m_Size += length;
-			return *this;
+			InternalAppend(string.data(), length);
+			return AppendLine();
 		}
 
 		/// <summary>
 		/// Adds the raw string literal argument to the end of the char buffer with a new line.
-		/// If argument is empty, it will return with no allocations.
+		/// If argument is empty, only the new line is added.
 		/// </summary>
 		/// <typeparam name="TSize">Represents the implicit capture of the raw string literal's size (including null termination)</typeparam>
 		/// <param name="string">Raw string literal to append</param>
@@ -424,28 +318,11 @@ namespace Micro
 		template <size_t TSize>
 		constexpr StringBuilder& AppendLine(const char(&string)[TSize]) noexcept
 		{
-			constexpr size_t length = TSize;
-			if constexpr (length == 0)
-				return *this;
-
-			if (m_Data == nullptr)
-			{
-				Allocate(MAX(length, DefaultCapacity));
-				InternalCopy(string, length - 1);
-			}
-			else
-			{
-				// Reallocate, if necessary
-				const size_t newSize = m_Size + length;
-				HandleReallocation(newSize);
-
-				// Set new data
-				InternalConcat(m_Size, string, length - 1);
-			}
+			constexpr size_t length = TSize - 1;
+			HandleReallocation(m_Size + length + 1);
 
-			InternalConcat(m_Size + length - 1, "\n", 1);
-			m_Size += length;
-			return *this;
+			InternalAppend(string, length);
+			return AppendLine();
 		}
 
 		/// <summary>
@@ -460,24 +337,10 @@ namespace Micro
 			if (length == 0)
 				return *this;
 
-			if (m_Data == nullptr)
-			{
-				Allocate(MAX(length + 1, DefaultCapacity));
-				InternalCopy(string, length);
-			}
-			else
-			{
-				// Reallocate, if necessary
-				const size_t newSize = m_Size + length + 1;
-				HandleReallocation(newSize);
-
-				// Set new data
-				InternalConcat(m_Size, string, length);
-			}
+			HandleReallocation(m_Size + length + 1);
 
-			InternalConcat(m_Size + length - 1, "\n", 1);
-			m_Size += length;
-			return *this;
+			InternalAppend(string, length);
+			return AppendLine();
 		}
 
 		/// <summary>
@@ -497,24 +360,8 @@ namespace Micro
 		/// <returns>Reference of this instance</returns>
 		constexpr StringBuilder& AppendLine(const char character) noexcept
 		{
-			constexpr size_t length = 2;
-			if (m_Data == nullptr)
-			{
-				Allocate(MAX(length, DefaultCapacity));
-				InternalCopy(&character, length - 1);
-			}
-			else
-			{
-				// Reallocate, if necessary
-				const size_t newSize = m_Size + length - 1;
-				HandleReallocation(newSize);
-
-				// Set new data
-				m_Data[m_Size] = character;
-				m_Data[m_Size + 1] = '\n';
-			}
-
-			m_Size += length;
+			const char line[] { character, '\n' };
+			InternalAppend(line, 2);
 			return *this;
 		}
 
@@ -541,14 +388,15 @@ namespace Micro
 		/// <returns>Reference of this instance</returns>
 		constexpr StringBuilder& Remove(const size_t start, const size_t length = 1) noexcept
 		{
-			const size_t size = start + length;
-			for (size_t i = start; i < size; i++)
-				m_Data[i] = -1;
+			if (start >= m_Size || length == 0)
+				return *this;
 
-			// Shift items down
-			ShiftLeft(m_Data, m_Size, start + 1, length);
+			// Shift items down (the range is cut at the end of the buffer)
+			const size_t count = MIN(length, m_Size - start);
+			ShiftLeft(m_Data, m_Size, start + count, count);
 
-			m_Size -= length;
+			m_Size -= count;
+			m_Data[m_Size] = 0;
 			return *this;
 		}
 
@@ -558,10 +406,42 @@ namespace Micro
 		/// <returns>New instance of a String using the character buffer.</returns>
 		NODISCARD constexpr String ToString() const noexcept { return { m_Data, m_Size }; }
 
+		/// <summary>
+		/// Makes room for the given number of characters, so appending up to it doesn't reallocate. Never shrinks.
+		/// </summary>
+		/// <param name="capacity">Number of characters to make room for</param>
+		constexpr void Reserve(const size_t capacity) noexcept
+		{
+			if (capacity > m_Capacity)
+				Reallocate(capacity);
+		}
+
+		/// <summary>
+		/// Reallocates the underlying buffer to fit the characters exactly, freeing it if the builder is empty.
+		/// </summary>
+		constexpr void ShrinkToFit() noexcept
+		{
+			if (m_Size != 0)
+			{
+				if (m_Capacity > m_Size)
+					Reallocate(m_Size);
+				return;
+			}
+
+			FreeBlock();
+			m_Data = nullptr;
+			m_Capacity = 0;
+		}
+
 		/**
 		 * \brief Soft clears the builder by setting the size to zero to avoid reallocation.
 		 */
-		constexpr void Clear() noexcept { m_Size = 0; }
+		constexpr void Clear() noexcept
+		{
+			m_Size = 0;
+			if (m_Data != nullptr)
+				m_Data[0] = 0;
+		}
 
 
 		/*
@@ -607,18 +487,9 @@ namespace Micro
 			if (this == &builder)
 				return *this;
 
-			const size_t length = builder.m_Size;
-			if (!m_Data)
-			{
-				Allocate(length);
-			}
-			else
-			{
-				if (length != m_Size)
-					Reallocate(length);
-			}
-
-			InternalCopy(builder.m_Data, length);
+			// The current buffer is reused when it is large enough
+			Clear();
+			InternalAppend(builder.m_Data, builder.m_Size);
 			return *this;
 		}
 
@@ -632,11 +503,12 @@ namespace Micro
 			if (this == &builder)
 				return *this;
 
-			delete[] m_Data;
+			FreeBlock();
 
 			m_Data = builder.m_Data;
 			m_Size = builder.m_Size;
 			m_Capacity = builder.m_Capacity;
+			m_Arena = builder.m_Arena;
 
 			builder.m_Data = nullptr;
 			builder.m_Size = 0;
@@ -679,28 +551,42 @@ namespace Micro
 		constexpr void Allocate(const size_t capacity) noexcept
 		{
 			if (capacity == 0) return;
+			TRACK_ALLOCATION_OWNER(StringBuilder);
 
 			const size_t length = capacity + 1;
-			m_Data = new char[length];
-			m_Data[capacity] = 0;
+			m_Data = m_Arena != nullptr ? m_Arena->Allocate<char>(length) : Alloc<char>(length);
+			m_Data[0] = 0;
 			m_Capacity = capacity;
 		}
 
 		/// <summary>
 		/// Reallocates a new block of memory or calls Allocate if the underlying buffer is null.
+		/// Characters past the new capacity are cut.
 		/// </summary>
 		/// <param name="capacity">New capacity to allocate with</param>
 		constexpr void Reallocate(const size_t capacity) noexcept
 		{
 			if (capacity == 0) return;
+			TRACK_ALLOCATION_OWNER(StringBuilder);
 			const size_t length = capacity + 1;
 
 			// Reallocation
 			if (m_Data != nullptr)
 			{
-				m_Data = static_cast<char*>(realloc(m_Data, length));
-				m_Data[capacity] = 0;
+				if (m_Arena != nullptr)
+					m_Data = static_cast<char*>(m_Arena->Reallocate(m_Data, m_Capacity + 1, length, alignof(char)));
+				else
+				{
+					// The block comes from 'operator new', so it can't go through 'realloc'
+					char* data = Alloc<char>(length);
+					std::memcpy(data, m_Data, MIN(m_Size, capacity));
+					Delete(m_Data, m_Capacity + 1);
+					m_Data = data;
+				}
+
 				m_Capacity = capacity;
+				m_Size = MIN(m_Size, capacity);
+				m_Data[m_Size] = 0;
 				return;
 			}
 
@@ -709,45 +595,63 @@ namespace Micro
 		}
 
 		/// <summary>
-		/// Determines the correct capacity to allocate or reallocate with. (Reallocates with
-		///	'capacity + (capacity / 2)', but uses the expected capacity when above that calculated value) 
+		/// Frees the underlying buffer, unless it belongs to an arena (which reclaims it on its own).
 		/// </summary>
-		/// <param name="expectedCapacity">Expected capacity to allocate with</param>
-		constexpr void HandleReallocation(const size_t expectedCapacity)
+		constexpr void FreeBlock() noexcept
 		{
-			if (expectedCapacity > m_Capacity)
-				Reallocate(MAX(m_Capacity + (m_Capacity / 2), expectedCapacity));
+			if (m_Arena == nullptr)
+				Delete(m_Data, m_Capacity + 1);
 		}
 
 		/// <summary>
-		/// Copies the char pointer into the underlying buffer using the given length.
+		/// Makes room for the expected capacity: the first allocation is at least 'DefaultCapacity', and later ones
+		/// grow by 1.5x (or to the expected capacity when above that).
 		/// </summary>
-		/// <param name="ptr">Char pointer to copy</param>
-		/// <param name="length">Length of char pointer</param>
-		constexpr void InternalCopy(const char* ptr, const size_t length) const noexcept
+		/// <param name="expectedCapacity">Expected capacity to allocate with</param>
+		constexpr void HandleReallocation(const size_t expectedCapacity) noexcept
 		{
-			for (size_t i = 0; i < length; i++)
-				new(&m_Data[i]) char(ptr[i]);
-
-			m_Data[m_Size] = 0;
+			if (m_Data == nullptr)
+				Allocate(MAX(expectedCapacity, DefaultCapacity));
+			else if (expectedCapacity > m_Capacity)
+				Reallocate(Growth::Grow(m_Capacity, expectedCapacity, sizeof(char)));
 		}
 
 		/// <summary>
-		/// Copies the char pointer into the underlying buffer using the given length at a given starting index.
+		/// Copies the char pointer to the end of the underlying buffer, growing it if necessary, and keeps the
+		/// buffer null terminated. The characters may come from this builder's own buffer.
 		/// </summary>
-		/// <param name="startIndex">Index to start internal copy</param>
 		/// <param name="ptr">Char pointer to copy</param>
 		/// <param name="length">Length of char pointer</param>
-		constexpr void InternalConcat(const size_t startIndex, const char* ptr, const size_t length) const noexcept
+		constexpr void InternalAppend(const char* ptr, const size_t length) noexcept
 		{
+			if (length == 0)
+				return;
+
+			const size_t size = m_Size + length;
+			if (m_Data == nullptr || size > m_Capacity)
+			{
+				const bool isOwn = m_Data != nullptr && ptr >= m_Data && ptr < m_Data + m_Capacity + 1;
+				const size_t offset = isOwn ? static_cast<size_t>(ptr - m_Data) : 0;
+
+				HandleReallocation(size);
+				if (isOwn)
+					ptr = m_Data + offset;
+			}
+
 			for (size_t i = 0; i < length; i++)
-				new(&m_Data[i + startIndex]) char(ptr[i]);
+				new(&m_Data[m_Size + i]) char(ptr[i]);
+
+			m_Size = size;
+			m_Data[m_Size] = 0;
 		}
 
 	private:
+		using Growth = GeometricGrowth<3, 2>;
+
 		char* m_Data = nullptr;
 		size_t m_Size = 0;
 		size_t m_Capacity = 0;
+		Arena* m_Arena = nullptr;
 
 		constexpr static size_t DefaultCapacity = 32;
 	};
@@ -782,12 +686,10 @@ namespace Micro
 	template <>
 	NODISCARD inline size_t Hash(const StringBuilder& object) noexcept
 	{
-		const size_t size = object.Length();
-		const auto data = object.Data();
-		size_t hash = 0;
-		for (size_t i = 0; i < size; i++)
-			hash += data[i];
-
-		return typeid(StringBuilder).hash_code() + size + hash;
+		return HashBytes(object.Data(), object.Length());
 	}
+
+	// Like String, a StringBuilder only refers to its buffer through a pointer
+	template <>
+	constexpr bool IsTriviallyRelocatable<StringBuilder> = true;
 }
@@ -25,5 +25,47 @@
 #error "Unknown compiler"
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SSE2_SUPPORTED  1
+#else
+#define SSE2_SUPPORTED  0
+#endif
+
+// Alignment used to keep data written by different threads on separate cache lines
+#define CACHE_LINE_SIZE 64
+
+// Tells the CPU the thread is spinning on a value another thread writes (saves power, frees the sibling hyperthread)
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define CPU_PAUSE()		_mm_pause()
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+#include <intrin.h>
+#define CPU_PAUSE()		__yield()
+#elif defined(__x86_64__) || defined(__i386__)
+#define CPU_PAUSE()		__builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define CPU_PAUSE()		__asm__ __volatile__("yield")
+#else
+#define CPU_PAUSE()
+#endif
+
+// Define as 1 before including the library to count every Alloc/Delete (see 'AllocationSnapshot')
+#ifndef TRACK_ALLOCATIONS
+#define TRACK_ALLOCATIONS 0
+#endif
+
+// Blocks of at least this many bytes from AlignedAlloc (collection allocators, Buffer) are mapped from the operating
+// system with huge pages, and grow without copying where it can remap them. Define as 0 to always use operator new.
+// Compile-time only, and must be the same in every translation unit that allocates or frees the same blocks
+#ifndef LARGE_ALLOCATION_THRESHOLD
+#define LARGE_ALLOCATION_THRESHOLD (64 * 1024 * 1024)
+#endif
+
 #define NODISCARD	[[nodiscard]]
-#define NORETURN	[[noreturn]]
\ No newline at end of file
+#define NORETURN	[[noreturn]]
+
+#if defined(_MSC_VER)
+#define NO_UNIQUE_ADDRESS	[[msvc::no_unique_address]]
+#else
+#define NO_UNIQUE_ADDRESS	[[no_unique_address]]
+#endif
\ No newline at end of file
@@ -14,7 +14,8 @@ namespace Micro
 		ArgumentOutOfRange,
 		InvalidOperation,
 		KeyNotFound,
-		IO
+		IO,
+		CapacityExceeded
 	};
 
 	class Error
@@ -134,6 +135,16 @@ namespace Micro
 	};
 
 
+	class CapacityExceededError final : public Error
+	{
+	public:
+		// No message, so reporting the error never allocates (fixed-capacity collections are used where that is forbidden)
+		constexpr CapacityExceededError() noexcept : Error(ErrorType::CapacityExceeded)
+		{
+		}
+	};
+
+
 	class IOError final : public Error
 	{
 	public:
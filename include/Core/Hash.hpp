@@ -1,15 +1,263 @@
 #pragma once
+#include <bit>
 #include <cstddef>
+#include <cstring>
 #include <typeinfo>
 #include <concepts>
+#include <type_traits>
 
 #include "Core.hpp"
+#include "Typedef.hpp"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
 
 namespace Micro
 {
+	// Seed used by every hash that isn't given one explicitly
+	constexpr u64 DefaultHashSeed = 0xA0761D6478BD642Full;
+
+	namespace Internal
+	{
+		// Secrets from wyhash (public domain), chosen for good avalanche with 64x64 -> 128 multiplies
+		constexpr u64 HashSecret[4] = { 0x2D358DCCAA6C78A5ull, 0x8BB84B93962EACC9ull, 0x4B33A62ED433D4A3ull, 0x4D5A2DA51DE1AA47ull };
+
+		/// <summary>
+		/// Multiplies two 64-bit values into 128 bits and folds the halves together.
+		/// </summary>
+		NODISCARD constexpr u64 MultiplyMix(const u64 left, const u64 right) noexcept
+		{
+#if defined(__SIZEOF_INT128__)
+			const __uint128_t product = static_cast<__uint128_t>(left) * right;
+			return static_cast<u64>(product) ^ static_cast<u64>(product >> 64);
+#else
+#if defined(_MSC_VER) && defined(_M_X64)
+			if (!std::is_constant_evaluated())
+			{
+				u64 high;
+				const u64 low = _umul128(left, right, &high);
+				return low ^ high;
+			}
+#endif
+			const u64 leftHigh = left >> 32, leftLow = left & 0xFFFFFFFF;
+			const u64 rightHigh = right >> 32, rightLow = right & 0xFFFFFFFF;
+			const u64 lowLow = leftLow * rightLow, highLow = leftHigh * rightLow;
+			const u64 lowHigh = leftLow * rightHigh, highHigh = leftHigh * rightHigh;
+			const u64 cross = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+			const u64 low = (cross << 32) | (lowLow & 0xFFFFFFFF);
+			const u64 high = highHigh + (highLow >> 32) + (cross >> 32);
+			return low ^ high;
+#endif
+		}
+
+		// Little-endian reads that also work during constant evaluation
+
+		NODISCARD constexpr u64 Read64(const char* data) noexcept
+		{
+			if (!std::is_constant_evaluated())
+			{
+				u64 value;
+				std::memcpy(&value, data, sizeof(u64));
+				return value;
+			}
+
+			u64 value = 0;
+			for (size_t i = 0; i < 8; i++)
+				value |= static_cast<u64>(static_cast<u8>(data[i])) << (i * 8);
+			return value;
+		}
+
+		NODISCARD constexpr u64 Read32(const char* data) noexcept
+		{
+			if (!std::is_constant_evaluated())
+			{
+				u32 value;
+				std::memcpy(&value, data, sizeof(u32));
+				return value;
+			}
+
+			u64 value = 0;
+			for (size_t i = 0; i < 4; i++)
+				value |= static_cast<u64>(static_cast<u8>(data[i])) << (i * 8);
+			return value;
+		}
+
+		NODISCARD constexpr u64 Read3(const char* data, const size_t length) noexcept
+		{
+			return (static_cast<u64>(static_cast<u8>(data[0])) << 16) |
+				(static_cast<u64>(static_cast<u8>(data[length >> 1])) << 8) |
+				static_cast<u64>(static_cast<u8>(data[length - 1]));
+		}
+	}
+
+
+	/*
+	 *  ============================================================
+	 *	|                     Hash Primitives                      |
+	 *  ============================================================
+	 */
+
+
+	/// <summary>
+	/// Hashes a sequence of bytes (wyhash construction: 8/16-byte loads, 48 bytes per loop iteration).
+	/// </summary>
+	/// <param name="data">Bytes to hash</param>
+	/// <param name="length">Number of bytes</param>
+	/// <param name="seed">Seed to hash with</param>
+	/// <returns>Hash code as a 'size_t'</returns>
+	NODISCARD constexpr size_t HashBytes(const char* data, const size_t length, const u64 seed = DefaultHashSeed) noexcept
+	{
+		using namespace Internal;
+
+		u64 state = seed ^ MultiplyMix(seed ^ HashSecret[0], HashSecret[1]);
+		u64 a = 0, b = 0;
+
+		if (length <= 16)
+		{
+			if (length >= 4)
+			{
+				const size_t offset = (length >> 3) << 2;
+				a = (Read32(data) << 32) | Read32(data + offset);
+				b = (Read32(data + length - 4) << 32) | Read32(data + length - 4 - offset);
+			}
+			else if (length > 0)
+				a = Read3(data, length);
+		}
+		else
+		{
+			size_t remaining = length;
+			const char* ptr = data;
+			if (remaining > 48)
+			{
+				u64 state1 = state, state2 = state;
+				do
+				{
+					state = MultiplyMix(Read64(ptr) ^ HashSecret[1], Read64(ptr + 8) ^ state);
+					state1 = MultiplyMix(Read64(ptr + 16) ^ HashSecret[2], Read64(ptr + 24) ^ state1);
+					state2 = MultiplyMix(Read64(ptr + 32) ^ HashSecret[3], Read64(ptr + 40) ^ state2);
+					ptr += 48;
+					remaining -= 48;
+				}
+				while (remaining > 48);
+
+				state ^= state1 ^ state2;
+			}
+
+			while (remaining > 16)
+			{
+				state = MultiplyMix(Read64(ptr) ^ HashSecret[1], Read64(ptr + 8) ^ state);
+				ptr += 16;
+				remaining -= 16;
+			}
+
+			a = Read64(ptr + remaining - 16);
+			b = Read64(ptr + remaining - 8);
+		}
+
+		a ^= HashSecret[1];
+		b ^= state;
+
+#if defined(__SIZEOF_INT128__)
+		const __uint128_t product = static_cast<__uint128_t>(a) * b;
+		a = static_cast<u64>(product);
+		b = static_cast<u64>(product >> 64);
+#else
+		const u64 low = a * b;
+		b = MultiplyMix(a, b) ^ low;
+		a = low;
+#endif
+
+		return static_cast<size_t>(MultiplyMix(a ^ HashSecret[0] ^ length, b ^ HashSecret[1]));
+	}
+
+	/// <summary>
+	/// Mixes a 64-bit integer so every input bit affects every output bit.
+	/// </summary>
+	/// <param name="value">Integer to mix</param>
+	/// <param name="seed">Seed to hash with</param>
+	/// <returns>Hash code as a 'size_t'</returns>
+	NODISCARD constexpr size_t HashInteger(const u64 value, const u64 seed = DefaultHashSeed) noexcept
+	{
+		return static_cast<size_t>(Internal::MultiplyMix(value ^ Internal::HashSecret[0], seed ^ Internal::HashSecret[1]));
+	}
+
+	/// <summary>
+	/// Combines an existing hash with another hash. Order dependent, so (a, b) and (b, a) differ.
+	/// </summary>
+	/// <param name="seed">Running hash</param>
+	/// <param name="hash">Hash to fold into the running hash</param>
+	/// <returns>Combined hash code as a 'size_t'</returns>
+	NODISCARD constexpr size_t HashCombine(const size_t seed, const size_t hash) noexcept
+	{
+		return static_cast<size_t>(Internal::MultiplyMix(seed ^ Internal::HashSecret[2], hash ^ Internal::HashSecret[3]));
+	}
+
+
+	/*
+	 *  ============================================================
+	 *	|                        Hash Overloads                    |
+	 *  ============================================================
+	 */
+
+
+	/// <summary>
+	/// Hashes an object. Types without padding are hashed by their bytes; any other type should provide its own
+	/// 'Hash' overload (or specialization), otherwise it falls back to a per-type constant.
+	/// </summary>
+	/// <param name="object">Object to hash</param>
+	/// <returns>Hash code as a 'size_t'</returns>
+	template <typename T>
+	NODISCARD size_t Hash(const T& object) noexcept
+	{
+		if constexpr (std::has_unique_object_representations_v<T>)
+			return HashBytes(reinterpret_cast<const char*>(&object), sizeof(T));
+		else
+			return typeid(T).hash_code();
+	}
+
+	NODISCARD constexpr size_t Hash(const std::integral auto& integral) noexcept
+	{
+		return HashInteger(static_cast<u64>(integral));
+	}
+
+	NODISCARD constexpr size_t Hash(const std::floating_point auto& flt) noexcept
+	{
+		// +0.0 and -0.0 compare equal, so they must hash equal
+		const f64 value = flt == 0 ? 0.0 : static_cast<f64>(flt);
+		return HashInteger(std::bit_cast<u64>(value));
+	}
+
+	/// <summary>
+	/// Hashes all the given values in order and combines them into one hash.
+	/// </summary>
+	/// <param name="values">Values to hash</param>
+	/// <returns>Combined hash code as a 'size_t'</returns>
+	template <typename... Args>
+	NODISCARD size_t HashValues(const Args&... values) noexcept
+	{
+		size_t hash = DefaultHashSeed;
+		((hash = HashCombine(hash, Hash(values))), ...);
+		return hash;
+	}
+
 	template <typename T>
-	NODISCARD size_t Hash(const T& object) noexcept { return typeid(T).hash_code(); }
+	concept Hashable = requires(const T& value)
+	{
+		{ Hash(value) } -> std::convertible_to<size_t>;
+	};
+
+	/// <summary>
+	/// Opts a lookup type into transparent lookup for tables keyed by 'TKey'. Specializations promise that a lookup
+	/// value comparing equal to a key also hashes equal to it, so the table can probe with it directly.
+	/// </summary>
+	template <typename TLookup, typename TKey>
+	constexpr bool IsTransparentKey = false;
 
-	NODISCARD constexpr size_t Hash(const std::integral auto& integral) noexcept { return integral; }
-	NODISCARD constexpr size_t Hash(const std::floating_point auto& flt) noexcept { return flt; }
+	template <typename TLookup, typename TKey>
+	concept TransparentKey = IsTransparentKey<TLookup, TKey> && requires(const TLookup& lookup, const TKey& key)
+	{
+		{ Hash(lookup) } -> std::convertible_to<size_t>;
+		{ key == lookup } -> std::convertible_to<bool>;
+	};
 }
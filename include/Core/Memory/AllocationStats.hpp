@@ -0,0 +1,667 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+
+#include "Core/Core.hpp"
+#include "Core/Typedef.hpp"
+
+#if TRACK_ALLOCATIONS
+#include <atomic>
+#include <mutex>
+#include <source_location>
+
+// Extra parameter of 'Alloc' capturing where it was called from, and the argument passing it on to another 'Alloc'
+#define ALLOCATION_SITE						, const std::source_location& allocationSite = std::source_location::current()
+#define FORWARD_ALLOCATION_SITE				, allocationSite
+#define TRACK_ALLOCATION(type, bytes)		::Micro::Internal::TrackAllocation<type>(bytes, allocationSite)
+#define TRACK_FREE(type, block, bytes)		::Micro::Internal::TrackFree<type>(block, bytes)
+
+// Counts the allocations made in the rest of the scope under the given container type instead of their source line
+#define TRACK_ALLOCATION_OWNER(...)			const ::Micro::Internal::AllocationOwnerScope allocationOwner(std::type_identity<__VA_ARGS__>{})
+#else
+#define ALLOCATION_SITE
+#define FORWARD_ALLOCATION_SITE
+#define TRACK_ALLOCATION(type, bytes)
+#define TRACK_FREE(type, block, bytes)
+#define TRACK_ALLOCATION_OWNER(...)
+#endif
+
+namespace Micro
+{
+	// Sizes are bucketed by bit width: bucket 'i' counts blocks of [2^(i-1), 2^i) bytes, the last one everything above
+	constexpr size_t AllocationHistogramBuckets = 24;
+
+	/// <summary>
+	/// Counters of one allocated type or call site.
+	/// </summary>
+	struct AllocationCounters final
+	{
+		i64 LiveBytes = 0;
+		i64 PeakBytes = 0;
+		u64 Allocations = 0;
+		u64 Frees = 0;
+		u64 AllocatedBytes = 0;
+		u64 Histogram[AllocationHistogramBuckets]{};
+
+		NODISCARD constexpr static size_t BucketOf(const size_t bytes) noexcept
+		{
+			return MIN(static_cast<size_t>(std::bit_width(bytes)), AllocationHistogramBuckets - 1);
+		}
+
+		constexpr void Add(const AllocationCounters& other) noexcept
+		{
+			LiveBytes += other.LiveBytes;
+			PeakBytes += other.PeakBytes;
+			Allocations += other.Allocations;
+			Frees += other.Frees;
+			AllocatedBytes += other.AllocatedBytes;
+			for (size_t i = 0; i < AllocationHistogramBuckets; i++)
+				Histogram[i] += other.Histogram[i];
+		}
+
+		/// <summary>
+		/// Removes the counts of an earlier state. The peak is kept, since it can't be subtracted.
+		/// </summary>
+		constexpr void Subtract(const AllocationCounters& before) noexcept
+		{
+			LiveBytes -= before.LiveBytes;
+			Allocations -= before.Allocations;
+			Frees -= before.Frees;
+			AllocatedBytes -= before.AllocatedBytes;
+			for (size_t i = 0; i < AllocationHistogramBuckets; i++)
+				Histogram[i] -= before.Histogram[i];
+		}
+	};
+
+	/// <summary>
+	/// Counters of an allocated type (name, no file), or of an allocation site: either the container type that
+	/// allocated (name, no file) or, outside of containers, the source line that called 'Alloc' (file and line).
+	/// </summary>
+	struct AllocationRecord final
+	{
+		const char* Name = "";
+		const char* File = nullptr;
+		u32 Line = 0;
+		AllocationCounters Counters;
+	};
+
+	namespace Internal
+	{
+		// Types and call sites past these limits are counted under the first '(other)' record
+		constexpr size_t MaxTrackedTypes = 128;
+		constexpr size_t MaxTrackedSites = 256;
+
+		struct AllocationTable final
+		{
+			size_t TypeCount = 0;
+			size_t SiteCount = 0;
+			AllocationCounters Total;
+			AllocationRecord Types[MaxTrackedTypes];
+			AllocationRecord Sites[MaxTrackedSites];
+		};
+	}
+
+	/**
+	 * \brief Counters of every Alloc/Delete of the process at one point in time, per allocated type and per
+	 *		  allocation site, plus their total. Only available when compiled with 'TRACK_ALLOCATIONS' set to 1;
+	 *		  otherwise Alloc/Delete carry no instrumentation at all and every snapshot is empty.
+	 *		  Memory a container allocates for itself is counted under the container type (e.g. 'HashTable<MapNode<K, V>>'
+	 *		  for a Map), any other 'Alloc' under the source line that called it.
+	 *		  Live and peak bytes are kept per type only, since a freed block doesn't know which site allocated it.
+	 *		  They are process-wide, so blocks freed by another thread than the one that allocated them balance out,
+	 *		  and a peak is the highest number of bytes that were live at once. Everything else is counted per thread.
+	 */
+	class AllocationSnapshot final
+	{
+	public:
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		AllocationSnapshot() noexcept = default;
+
+		/// <summary>
+		/// Sums the counters of all live threads and of the threads that already exited.
+		/// </summary>
+		NODISCARD static AllocationSnapshot Capture() noexcept;
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD constexpr static bool IsEnabled() noexcept { return TRACK_ALLOCATIONS; }
+
+		NODISCARD const AllocationCounters& Total() const noexcept { return m_Table != nullptr ? m_Table->Total : s_Empty; }
+
+		NODISCARD size_t TypeCount() const noexcept { return m_Table != nullptr ? m_Table->TypeCount : 0; }
+		NODISCARD const AllocationRecord& Type(const size_t index) const noexcept { return m_Table->Types[index]; }
+
+		NODISCARD size_t SiteCount() const noexcept { return m_Table != nullptr ? m_Table->SiteCount : 0; }
+		NODISCARD const AllocationRecord& Site(const size_t index) const noexcept { return m_Table->Sites[index]; }
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Counts what happened between an earlier snapshot and this one (peaks are this snapshot's).
+		/// </summary>
+		NODISCARD AllocationSnapshot operator-(const AllocationSnapshot& before) const noexcept
+		{
+			AllocationSnapshot difference;
+			if (m_Table == nullptr)
+				return difference;
+
+			difference.m_Table = std::make_unique<Internal::AllocationTable>(*m_Table);
+			if (before.m_Table == nullptr)
+				return difference;
+
+			// Records are registered once and never move, so the same index is the same type/site
+			Internal::AllocationTable& table = *difference.m_Table;
+			table.Total.Subtract(before.m_Table->Total);
+			for (size_t i = 0; i < before.m_Table->TypeCount; i++)
+				table.Types[i].Counters.Subtract(before.m_Table->Types[i].Counters);
+			for (size_t i = 0; i < before.m_Table->SiteCount; i++)
+				table.Sites[i].Counters.Subtract(before.m_Table->Sites[i].Counters);
+
+			return difference;
+		}
+
+		/// <summary>
+		/// Writes the total and every type and site that allocated or still holds memory.
+		/// </summary>
+		friend std::ostream& operator<<(std::ostream& stream, const AllocationSnapshot& snapshot) noexcept
+		{
+			if (!IsEnabled())
+				return stream << "Allocation tracking is disabled (compile with TRACK_ALLOCATIONS=1)\n";
+
+			stream << "Total: ";
+			WriteCounters(stream, snapshot.Total());
+
+			stream << "Types:\n";
+			for (size_t i = 0; i < snapshot.TypeCount(); i++)
+			{
+				const AllocationRecord& record = snapshot.Type(i);
+				if (record.Counters.Allocations == 0 && record.Counters.LiveBytes == 0)
+					continue;
+
+				stream << "  " << record.Name << ": ";
+				WriteCounters(stream, record.Counters);
+			}
+
+			stream << "Sites:\n";
+			for (size_t i = 0; i < snapshot.SiteCount(); i++)
+			{
+				const AllocationRecord& record = snapshot.Site(i);
+				if (record.Counters.Allocations == 0)
+					continue;
+
+				stream << "  ";
+				if (record.File != nullptr)
+					stream << record.File << ':' << record.Line;
+				else
+					stream << record.Name;
+				stream << ": ";
+				WriteCounters(stream, record.Counters, true);
+			}
+
+			return stream;
+		}
+
+	private:
+		static void WriteCounters(std::ostream& stream, const AllocationCounters& counters, const bool isSite = false) noexcept
+		{
+			stream << counters.Allocations << " allocs, " << counters.AllocatedBytes << " B allocated";
+			if (!isSite)
+				stream << ", " << counters.Frees << " frees, " << counters.LiveBytes << " B live, " << counters.PeakBytes << " B peak";
+			stream << " |";
+
+			for (size_t i = 0; i < AllocationHistogramBuckets; i++)
+			{
+				if (counters.Histogram[i] != 0)
+					stream << ' ' << (i == 0 ? 0 : static_cast<u64>(1) << (i - 1)) << "B+:" << counters.Histogram[i];
+			}
+			stream << '\n';
+		}
+
+	private:
+		std::unique_ptr<Internal::AllocationTable> m_Table;
+
+		inline static const AllocationCounters s_Empty{};
+	};
+
+#if TRACK_ALLOCATIONS
+	namespace Internal
+	{
+		/// <summary>
+		/// Counters written by their owning thread only, so updates are plain loads and stores; other threads only
+		/// read them while taking a snapshot. Live and peak bytes are in the registry, since frees can come from any
+		/// thread.
+		/// </summary>
+		struct ThreadCounters final
+		{
+			std::atomic<u64> Allocations{ 0 };
+			std::atomic<u64> Frees{ 0 };
+			std::atomic<u64> AllocatedBytes{ 0 };
+			std::atomic<u64> Histogram[AllocationHistogramBuckets]{};
+
+			template <typename TValue>
+			static void Bump(std::atomic<TValue>& counter, const TValue amount) noexcept
+			{
+				counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+			}
+
+			void OnAllocate(const size_t bytes) noexcept
+			{
+				Bump<u64>(Allocations, 1);
+				Bump<u64>(AllocatedBytes, bytes);
+				Bump<u64>(Histogram[AllocationCounters::BucketOf(bytes)], 1);
+			}
+
+			void OnFree() noexcept { Bump<u64>(Frees, 1); }
+
+			void AddTo(AllocationCounters& counters) const noexcept
+			{
+				counters.Allocations += Allocations.load(std::memory_order_relaxed);
+				counters.Frees += Frees.load(std::memory_order_relaxed);
+				counters.AllocatedBytes += AllocatedBytes.load(std::memory_order_relaxed);
+				for (size_t i = 0; i < AllocationHistogramBuckets; i++)
+					counters.Histogram[i] += Histogram[i].load(std::memory_order_relaxed);
+			}
+		};
+
+		/// <summary>
+		/// Direct-mapped per-thread cache from a call site to its record, so only the first allocation of a site
+		/// (per thread) takes the registry lock.
+		/// </summary>
+		struct SiteCacheEntry final
+		{
+			const char* File = nullptr;
+			u32 Line = 0;
+			u32 Index = 0;
+		};
+
+		constexpr size_t SiteCacheSize = 64;
+
+		struct ThreadAllocationCounters final
+		{
+			ThreadCounters Types[MaxTrackedTypes];
+			ThreadCounters Sites[MaxTrackedSites];
+			SiteCacheEntry SiteCache[SiteCacheSize];
+			ThreadAllocationCounters* Previous = nullptr;
+			ThreadAllocationCounters* Next = nullptr;
+		};
+
+		constexpr size_t MaxTypeNameLength = 128;
+
+		/// <summary>
+		/// Bytes that are live right now, and the most that ever were.
+		/// </summary>
+		struct LiveCounter final
+		{
+			std::atomic<i64> Bytes{ 0 };
+			std::atomic<i64> Peak{ 0 };
+
+			void Add(const size_t bytes) noexcept
+			{
+				const i64 live = Bytes.fetch_add(static_cast<i64>(bytes), std::memory_order_relaxed) + static_cast<i64>(bytes);
+				i64 peak = Peak.load(std::memory_order_relaxed);
+				while (live > peak && !Peak.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+				{
+				}
+			}
+
+			void Subtract(const size_t bytes) noexcept { Bytes.fetch_sub(static_cast<i64>(bytes), std::memory_order_relaxed); }
+
+			void CopyTo(AllocationCounters& counters) const noexcept
+			{
+				counters.LiveBytes = Bytes.load(std::memory_order_relaxed);
+				counters.PeakBytes = Peak.load(std::memory_order_relaxed);
+			}
+		};
+
+		struct AllocationRegistry final
+		{
+			std::mutex Lock;
+			size_t TypeCount = 1;
+			size_t SiteCount = 1;
+			char TypeNames[MaxTrackedTypes][MaxTypeNameLength]{ "(other)" };
+			char OwnerNames[MaxTrackedSites][MaxTypeNameLength]{};
+			AllocationRecord Sites[MaxTrackedSites]{ { "(other)", nullptr, 0, {} } };
+			ThreadAllocationCounters* Threads = nullptr;
+
+			// Shared by all threads, so a block may be freed by another thread than the one that allocated it
+			LiveCounter Live[MaxTrackedTypes];
+			LiveCounter TotalLive;
+
+			// Counters of exited threads (and of frees made after a thread's counters were retired)
+			ThreadAllocationCounters Retired;
+		};
+
+		/// <summary>
+		/// Never destroyed, since blocks can still be freed during static destruction.
+		/// </summary>
+		inline AllocationRegistry& Registry() noexcept
+		{
+			static AllocationRegistry* registry = new AllocationRegistry();
+			return *registry;
+		}
+
+		template <typename T>
+		NODISCARD constexpr const char* SignatureOf() noexcept
+		{
+#if defined(_MSC_VER)
+			return __FUNCSIG__;
+#else
+			return __PRETTY_FUNCTION__;
+#endif
+		}
+
+		/// <summary>
+		/// Copies the type name found in the signature of 'SignatureOf&lt;T&gt;' into the buffer.
+		/// </summary>
+		inline void CopyTypeName(const char* signature, char (&name)[MaxTypeNameLength]) noexcept
+		{
+			// GCC/Clang: "... [with T = Name]" / "... [T = Name]", MSVC: "... SignatureOf<Name>(void) noexcept"
+			const char* begin = std::strstr(signature, "T = ");
+			const char* end;
+			if (begin != nullptr)
+			{
+				begin += 4;
+				end = std::strrchr(begin, ']');
+			}
+			else
+			{
+				begin = std::strstr(signature, "SignatureOf<");
+				begin = begin != nullptr ? begin + 12 : signature;
+				end = std::strrchr(begin, '>');
+			}
+
+			const size_t length = end != nullptr ? MIN(static_cast<size_t>(end - begin), MaxTypeNameLength - 1) : 0;
+			std::memcpy(name, begin, length);
+			name[length] = 0;
+		}
+
+		/// <summary>
+		/// Registers a type under the name found in the signature of 'SignatureOf&lt;T&gt;'.
+		/// </summary>
+		inline u32 RegisterType(const char* signature) noexcept
+		{
+			AllocationRegistry& registry = Registry();
+			std::lock_guard lock(registry.Lock);
+			if (registry.TypeCount == MaxTrackedTypes)
+				return 0;
+
+			CopyTypeName(signature, registry.TypeNames[registry.TypeCount]);
+			return static_cast<u32>(registry.TypeCount++);
+		}
+
+		template <typename T>
+		NODISCARD u32 TypeIndexOf() noexcept
+		{
+			static const u32 index = RegisterType(SignatureOf<T>());
+			return index;
+		}
+
+		inline u32 RegisterSite(const std::source_location& location) noexcept
+		{
+			AllocationRegistry& registry = Registry();
+			std::lock_guard lock(registry.Lock);
+
+			// The same site can be seen from several threads (or with a different file pointer per translation unit)
+			for (size_t i = 1; i < registry.SiteCount; i++)
+			{
+				const AllocationRecord& site = registry.Sites[i];
+				if (site.Line == location.line() && std::strcmp(site.File, location.file_name()) == 0)
+					return static_cast<u32>(i);
+			}
+
+			if (registry.SiteCount == MaxTrackedSites)
+				return 0;
+
+			AllocationRecord& site = registry.Sites[registry.SiteCount];
+			site.File = location.file_name();
+			site.Line = location.line();
+			return static_cast<u32>(registry.SiteCount++);
+		}
+
+		/// <summary>
+		/// Registers a container type as an allocation site, named like a type of 'RegisterType'.
+		/// </summary>
+		inline u32 RegisterOwner(const char* signature) noexcept
+		{
+			AllocationRegistry& registry = Registry();
+			std::lock_guard lock(registry.Lock);
+			if (registry.SiteCount == MaxTrackedSites)
+				return 0;
+
+			char (&name)[MaxTypeNameLength] = registry.OwnerNames[registry.SiteCount];
+			CopyTypeName(signature, name);
+			registry.Sites[registry.SiteCount].Name = name;
+			return static_cast<u32>(registry.SiteCount++);
+		}
+
+		template <typename TOwner>
+		NODISCARD u32 OwnerIndexOf() noexcept
+		{
+			static const u32 index = RegisterOwner(SignatureOf<TOwner>());
+			return index;
+		}
+
+		constexpr u32 NoAllocationOwner = ~0u;
+
+		inline thread_local u32 t_AllocationOwner = NoAllocationOwner;
+
+		/// <summary>
+		/// Counts the allocations of the calling thread under a container type while alive. Scopes nest, and the
+		/// innermost one wins, so the elements a container copies are still counted under their own type.
+		/// </summary>
+		struct AllocationOwnerScope final
+		{
+			// Constexpr, so containers can open one in their constexpr helpers; nothing is counted at compile time
+			template <typename TOwner>
+			constexpr explicit AllocationOwnerScope(std::type_identity<TOwner>) noexcept
+			{
+				if (!std::is_constant_evaluated())
+				{
+					Previous = t_AllocationOwner;
+					t_AllocationOwner = OwnerIndexOf<TOwner>();
+				}
+			}
+
+			constexpr ~AllocationOwnerScope() noexcept
+			{
+				if (!std::is_constant_evaluated())
+					t_AllocationOwner = Previous;
+			}
+
+			AllocationOwnerScope(const AllocationOwnerScope&) = delete;
+			AllocationOwnerScope& operator=(const AllocationOwnerScope&) = delete;
+
+			u32 Previous = NoAllocationOwner;
+		};
+
+		inline thread_local ThreadAllocationCounters* t_AllocationCounters = nullptr;
+		inline thread_local bool t_AllocationCountersRetired = false;
+
+		/// <summary>
+		/// Folds the counters of an exiting thread into the retired counters.
+		/// </summary>
+		struct ThreadCountersGuard final
+		{
+			~ThreadCountersGuard() noexcept
+			{
+				ThreadAllocationCounters* counters = t_AllocationCounters;
+				t_AllocationCounters = nullptr;
+				t_AllocationCountersRetired = true;
+				if (counters == nullptr)
+					return;
+
+				AllocationRegistry& registry = Registry();
+				std::lock_guard lock(registry.Lock);
+
+				const auto fold = [](const ThreadCounters& from, ThreadCounters& into)
+				{
+					AllocationCounters sum;
+					from.AddTo(sum);
+					into.Allocations.fetch_add(sum.Allocations, std::memory_order_relaxed);
+					into.Frees.fetch_add(sum.Frees, std::memory_order_relaxed);
+					into.AllocatedBytes.fetch_add(sum.AllocatedBytes, std::memory_order_relaxed);
+					for (size_t i = 0; i < AllocationHistogramBuckets; i++)
+						into.Histogram[i].fetch_add(sum.Histogram[i], std::memory_order_relaxed);
+				};
+
+				for (size_t i = 0; i < MaxTrackedTypes; i++)
+					fold(counters->Types[i], registry.Retired.Types[i]);
+				for (size_t i = 0; i < MaxTrackedSites; i++)
+					fold(counters->Sites[i], registry.Retired.Sites[i]);
+
+				if (counters->Previous != nullptr)
+					counters->Previous->Next = counters->Next;
+				else
+					registry.Threads = counters->Next;
+				if (counters->Next != nullptr)
+					counters->Next->Previous = counters->Previous;
+
+				delete counters;
+			}
+		};
+
+		/// <summary>
+		/// Gets the counters of the calling thread, registering them on first use. Null once the thread is exiting.
+		/// </summary>
+		inline ThreadAllocationCounters* ThreadAllocationCountersOf() noexcept
+		{
+			if (t_AllocationCounters != nullptr || t_AllocationCountersRetired)
+				return t_AllocationCounters;
+
+			thread_local ThreadCountersGuard guard;
+			(void)guard;
+
+			auto* counters = new ThreadAllocationCounters();
+			AllocationRegistry& registry = Registry();
+			{
+				std::lock_guard lock(registry.Lock);
+				counters->Next = registry.Threads;
+				if (registry.Threads != nullptr)
+					registry.Threads->Previous = counters;
+				registry.Threads = counters;
+			}
+
+			t_AllocationCounters = counters;
+			return counters;
+		}
+
+		template <typename T>
+		void TrackAllocation(const size_t bytes, const std::source_location& location) noexcept
+		{
+			const u32 type = TypeIndexOf<T>();
+			AllocationRegistry& registry = Registry();
+			registry.Live[type].Add(bytes);
+			registry.TotalLive.Add(bytes);
+
+			ThreadAllocationCounters* counters = ThreadAllocationCountersOf();
+			if (counters == nullptr)
+			{
+				// Thread is exiting, count in the shared retired counters instead
+				std::lock_guard lock(registry.Lock);
+				registry.Retired.Types[type].OnAllocate(bytes);
+				return;
+			}
+
+			counters->Types[type].OnAllocate(bytes);
+			if (t_AllocationOwner != NoAllocationOwner)
+			{
+				counters->Sites[t_AllocationOwner].OnAllocate(bytes);
+				return;
+			}
+
+			const uintptr_t key = reinterpret_cast<uintptr_t>(location.file_name()) ^ (static_cast<uintptr_t>(location.line()) * 0x9E3779B1u);
+			SiteCacheEntry& entry = counters->SiteCache[(key ^ (key >> 7)) & (SiteCacheSize - 1)];
+			if (entry.File != location.file_name() || entry.Line != location.line())
+				entry = { location.file_name(), location.line(), RegisterSite(location) };
+
+			counters->Sites[entry.Index].OnAllocate(bytes);
+		}
+
+		template <typename T>
+		void TrackFree(const T* block, const size_t bytes) noexcept
+		{
+			if (block == nullptr)
+				return;
+
+			const u32 type = TypeIndexOf<T>();
+			AllocationRegistry& registry = Registry();
+			registry.Live[type].Subtract(bytes);
+			registry.TotalLive.Subtract(bytes);
+
+			ThreadAllocationCounters* counters = ThreadAllocationCountersOf();
+			if (counters == nullptr)
+			{
+				std::lock_guard lock(registry.Lock);
+				registry.Retired.Types[type].OnFree();
+				return;
+			}
+
+			counters->Types[type].OnFree();
+		}
+	}
+
+	inline AllocationSnapshot AllocationSnapshot::Capture() noexcept
+	{
+		using namespace Internal;
+
+		AllocationSnapshot snapshot;
+		snapshot.m_Table = std::make_unique<AllocationTable>();
+		AllocationTable& table = *snapshot.m_Table;
+
+		AllocationRegistry& registry = Registry();
+		std::lock_guard lock(registry.Lock);
+
+		table.TypeCount = registry.TypeCount;
+		table.SiteCount = registry.SiteCount;
+		for (size_t i = 0; i < table.TypeCount; i++)
+		{
+			table.Types[i].Name = registry.TypeNames[i];
+			registry.Retired.Types[i].AddTo(table.Types[i].Counters);
+			for (const ThreadAllocationCounters* thread = registry.Threads; thread != nullptr; thread = thread->Next)
+				thread->Types[i].AddTo(table.Types[i].Counters);
+
+			registry.Live[i].CopyTo(table.Types[i].Counters);
+			table.Total.Add(table.Types[i].Counters);
+		}
+
+		// The peaks of the types were reached at different times, so their sum isn't the total peak
+		registry.TotalLive.CopyTo(table.Total);
+
+		for (size_t i = 0; i < table.SiteCount; i++)
+		{
+			table.Sites[i].Name = registry.Sites[i].Name;
+			table.Sites[i].File = registry.Sites[i].File;
+			table.Sites[i].Line = registry.Sites[i].Line;
+			registry.Retired.Sites[i].AddTo(table.Sites[i].Counters);
+			for (const ThreadAllocationCounters* thread = registry.Threads; thread != nullptr; thread = thread->Next)
+				thread->Sites[i].AddTo(table.Sites[i].Counters);
+		}
+
+		return snapshot;
+	}
+#else
+	inline AllocationSnapshot AllocationSnapshot::Capture() noexcept { return {}; }
+#endif
+}
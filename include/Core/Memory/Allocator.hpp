@@ -1,52 +1,96 @@
 #pragma once
+#include <bit>
+#include <concepts>
+
 #include "Memory.hpp"
 
 namespace Micro
 {
-	template <typename T>
+	/// <summary>
+	/// Interface HeapCollection expects from its allocator. Stateless allocators (like the default one) may
+	/// implement it with static functions; stateful ones are stored in the collection and called through it.
+	/// </summary>
+	template <typename TAllocator, typename T>
+	concept CollectionAllocator = requires(TAllocator& allocator, Memory<T>& data, const size_t capacity)
+	{
+		{ allocator.Allocate(data, capacity, capacity) } -> std::same_as<size_t>;
+		{ allocator.Reallocate(data, capacity, capacity, capacity) } -> std::same_as<size_t>;
+		allocator.ClearMemory(data, capacity);
+		allocator.Dispose(data, capacity);
+	};
+
+	/**
+	 * \brief Default collection allocator, going through AlignedAlloc/AlignedDelete (global operator new/delete, or
+	 *		  pages mapped from the operating system for blocks above 'LARGE_ALLOCATION_THRESHOLD').
+	 * \tparam T Type of elements to allocate
+	 * \tparam TAlignment Alignment of the element block (never less than 'alignof(T)')
+	 */
+	template <typename T, size_t TAlignment = alignof(T)>
 	class Allocator final
 	{
+		static_assert(std::has_single_bit(TAlignment), "Alignment must be a power of two.");
+
 	public:
+		constexpr static size_t Alignment = MAX(TAlignment, alignof(T));
+
 		NODISCARD constexpr static size_t Allocate(Memory<T>& data, const size_t currentCapacity, const size_t newCapacity) noexcept
 		{
 			// Don't allocate if same capacity
 			if (currentCapacity == newCapacity)
 				return currentCapacity;
 
-			data = Alloc<T>(newCapacity);
+			data = AlignedAlloc<T>(newCapacity, Alignment);
 			return newCapacity;
 		}
 
-		NODISCARD constexpr static size_t Reallocate(Memory<T>& data, const size_t currentCapacity, const size_t newCapacity) noexcept
+		/// <summary>
+		/// Moves the block to a new allocation of the given capacity. Only the first 'size' elements are live; they are
+		/// relocated (one memcpy for trivially relocatable types), anything past the new capacity is destroyed.
+		/// </summary>
+		NODISCARD constexpr static size_t Reallocate(Memory<T>& data, const size_t size, const size_t currentCapacity,
+		                                             const size_t newCapacity) noexcept
 		{
 			// Don't reallocate if same capacity
 			if (currentCapacity == newCapacity)
 				return currentCapacity;
 
-			// Allocate (with constructor call)
-			T* newBlock = Alloc<T>(newCapacity);
-
-			// Move memory to new block and free old block
-			for (size_t i = 0; i < currentCapacity; i++)
+			// Large blocks of trivially relocatable elements are remapped in place of a copy
+			if constexpr (TriviallyRelocatable<T>)
 			{
-				newBlock[i] = std::move(data[i]);
-				data[i].~T();
+				if (IsLargeAllocation(currentCapacity * sizeof(T), Alignment) && IsLargeAllocation(newCapacity * sizeof(T), Alignment))
+				{
+					ClearMemory(data, MIN(size, newCapacity), size);
+					data = AlignedReallocate<T>(data.Data, currentCapacity, newCapacity, Alignment);
+					return newCapacity;
+				}
 			}
 
-			// Free invalid memory
+			T* newBlock = AlignedAlloc<T>(newCapacity, Alignment);
+
+			// Move live elements to the new block, then free the old block
+			const size_t count = MIN(size, newCapacity);
+			Relocate(data.Data, count, newBlock);
+			ClearMemory(data, count, size);
 			Dispose(data, currentCapacity);
 
 			data = newBlock;
 			return newCapacity;
 		}
 
-		constexpr static void ClearMemory(Memory<T>& data, const size_t capacity) noexcept
+		constexpr static void ClearMemory(Memory<T>& data, const size_t capacity) noexcept { ClearMemory(data, 0, capacity); }
+
+		/// <summary>
+		/// Destroys the elements in the range [start, end).
+		/// </summary>
+		constexpr static void ClearMemory(Memory<T>& data, const size_t start, const size_t end) noexcept
 		{
-			// Invalidate memory
-			for (size_t i = 0; i < capacity; i++)
-				data[i].~T();
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (size_t i = start; i < end; i++)
+					data[i].~T();
+			}
 		}
 
-		constexpr static void Dispose(Memory<T>& data, const size_t capacity) noexcept { Delete(data.Data, capacity); }
+		constexpr static void Dispose(Memory<T>& data, const size_t capacity) noexcept { AlignedDelete(data.Data, capacity, Alignment); }
 	};
 }
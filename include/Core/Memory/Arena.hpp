@@ -0,0 +1,327 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+
+#include "Core/Core.hpp"
+#include "Core/Typedef.hpp"
+#include "Core/Memory/Memory.hpp"
+
+namespace Micro
+{
+	/// <summary>
+	/// Position inside an Arena, returned by 'Arena::Mark' and restored by 'Arena::Rewind'.
+	/// </summary>
+	struct ArenaMark final
+	{
+		void* Chunk = nullptr;
+		size_t Offset = 0;
+	};
+
+	/**
+	 * \brief Monotonic allocator that bump-allocates from large chunks. Individual allocations are never freed;
+	 *		  memory is reclaimed all at once with 'Rewind' (back to a mark) or 'Reset' (everything). Chunks are kept
+	 *		  for reuse until the arena is destroyed, so a reset arena allocates without touching the global heap.
+	 *		  Objects living in the arena are not destroyed by it; trivially destructible data (or containers that
+	 *		  were destroyed first) is expected.
+	 */
+	class Arena final
+	{
+	public:
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		constexpr explicit Arena(const size_t chunkSize = DefaultChunkSize) noexcept
+			: m_ChunkSize(MAX(chunkSize, sizeof(Chunk)))
+		{
+		}
+
+		Arena(const Arena&) = delete;
+
+		constexpr Arena(Arena&& other) noexcept
+			: m_First(other.m_First), m_Current(other.m_Current), m_Offset(other.m_Offset), m_ChunkSize(other.m_ChunkSize)
+		{
+			other.m_First = nullptr;
+			other.m_Current = nullptr;
+			other.m_Offset = 0;
+		}
+
+		~Arena() noexcept
+		{
+			Chunk* chunk = m_First;
+			while (chunk != nullptr)
+			{
+				Chunk* next = chunk->Next;
+				Delete(reinterpret_cast<char*>(chunk), chunk->Capacity);
+				chunk = next;
+			}
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD constexpr size_t ChunkSize() const noexcept { return m_ChunkSize; }
+
+		/// <summary>
+		/// Total bytes of the chunks owned by the arena (used or not).
+		/// </summary>
+		NODISCARD size_t Reserved() const noexcept
+		{
+			size_t total = 0;
+			for (const Chunk* chunk = m_First; chunk != nullptr; chunk = chunk->Next)
+				total += chunk->Capacity;
+			return total;
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Utility                          |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Allocates a block from the current chunk, moving on to the next chunk (or a new one) when it doesn't fit.
+		/// </summary>
+		/// <param name="size">Number of bytes</param>
+		/// <param name="alignment">Alignment of the block (power of two)</param>
+		/// <returns>Uninitialized block, valid until the arena is rewound past it, reset or destroyed</returns>
+		NODISCARD void* Allocate(const size_t size, const size_t alignment = alignof(std::max_align_t)) noexcept
+		{
+			if (m_Current != nullptr)
+			{
+				if (void* block = TryBump(m_Current, m_Offset, size, alignment))
+					return block;
+			}
+
+			NextChunk(size, alignment);
+			return TryBump(m_Current, m_Offset, size, alignment);
+		}
+
+		/// <summary>
+		/// Allocates uninitialized storage for the given number of elements, aligned for the type.
+		/// </summary>
+		template <typename T>
+		NODISCARD T* Allocate(const size_t count) noexcept
+		{
+			return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+		}
+
+		/// <summary>
+		/// Resizes a block of this arena. The most recent allocation grows or shrinks in place when its chunk has
+		/// room; any other block is copied into a new allocation (the old one stays used until a rewind).
+		/// </summary>
+		/// <param name="block">Block to resize (or null, to allocate)</param>
+		/// <param name="size">Current size of the block</param>
+		/// <param name="newSize">Requested size</param>
+		/// <param name="alignment">Alignment the block was allocated with</param>
+		/// <returns>Block holding the first 'MIN(size, newSize)' bytes of the old one</returns>
+		NODISCARD void* Reallocate(void* block, const size_t size, const size_t newSize,
+		                           const size_t alignment = alignof(std::max_align_t)) noexcept
+		{
+			if (block == nullptr)
+				return Allocate(newSize, alignment);
+
+			if (m_Current != nullptr)
+			{
+				char* data = DataOf(m_Current);
+				char* end = data + m_Offset;
+				const bool isLast = static_cast<char*>(block) + size == end && static_cast<char*>(block) >= data;
+				const size_t offset = static_cast<char*>(block) - data;
+				if (isLast && offset + newSize <= m_Current->Capacity - sizeof(Chunk))
+				{
+					m_Offset = offset + newSize;
+					return block;
+				}
+			}
+
+			void* newBlock = Allocate(newSize, alignment);
+			std::memcpy(newBlock, block, MIN(size, newSize));
+			return newBlock;
+		}
+
+		/// <summary>
+		/// Gets the current position, to return to later with 'Rewind'.
+		/// </summary>
+		NODISCARD constexpr ArenaMark Mark() const noexcept { return { m_Current, m_Offset }; }
+
+		/// <summary>
+		/// Frees everything allocated after the mark was taken. Marks taken after it become invalid.
+		/// </summary>
+		/// <param name="mark">Mark from this arena</param>
+		constexpr void Rewind(const ArenaMark& mark) noexcept
+		{
+			m_Current = static_cast<Chunk*>(mark.Chunk);
+			m_Offset = mark.Offset;
+		}
+
+		/// <summary>
+		/// Frees every allocation, keeping the chunks for reuse.
+		/// </summary>
+		constexpr void Reset() noexcept
+		{
+			m_Current = nullptr;
+			m_Offset = 0;
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		Arena& operator=(const Arena&) = delete;
+		Arena& operator=(Arena&&) = delete;
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		// Header at the start of every chunk, followed by its data
+		struct alignas(std::max_align_t) Chunk
+		{
+			Chunk* Next;
+			size_t Capacity;
+		};
+
+		NODISCARD static char* DataOf(Chunk* chunk) noexcept { return reinterpret_cast<char*>(chunk + 1); }
+
+		/// <summary>
+		/// Bumps the offset past an aligned block of the chunk, if it fits.
+		/// </summary>
+		NODISCARD static void* TryBump(Chunk* chunk, size_t& offset, const size_t size, const size_t alignment) noexcept
+		{
+			char* data = DataOf(chunk);
+			const uintptr_t address = reinterpret_cast<uintptr_t>(data + offset);
+			const size_t start = offset + ((alignment - address % alignment) % alignment);
+			if (start + size > chunk->Capacity - sizeof(Chunk))
+				return nullptr;
+
+			offset = start + size;
+			return data + start;
+		}
+
+		/// <summary>
+		/// Moves on to the first following chunk that fits the allocation, or appends a new one to the chunk list.
+		/// </summary>
+		void NextChunk(const size_t size, const size_t alignment) noexcept
+		{
+			const size_t required = sizeof(Chunk) + size + alignment;
+
+			Chunk* previous = m_Current;
+			Chunk* next = m_Current == nullptr ? m_First : m_Current->Next;
+			while (next != nullptr)
+			{
+				if (next->Capacity >= required)
+				{
+					m_Current = next;
+					m_Offset = 0;
+					return;
+				}
+
+				previous = next;
+				next = next->Next;
+			}
+
+			// Oversized requests get a chunk of their own
+			const size_t capacity = MAX(m_ChunkSize, required);
+			TRACK_ALLOCATION_OWNER(Arena);
+			Chunk* chunk = reinterpret_cast<Chunk*>(Alloc<char>(capacity));
+			chunk->Next = nullptr;
+			chunk->Capacity = capacity;
+
+			if (previous == nullptr)
+				m_First = chunk;
+			else
+				previous->Next = chunk;
+
+			m_Current = chunk;
+			m_Offset = 0;
+		}
+
+	private:
+		Chunk* m_First = nullptr;
+		Chunk* m_Current = nullptr;
+		size_t m_Offset = 0;
+		size_t m_ChunkSize;
+
+		constexpr static size_t DefaultChunkSize = 64 * 1024;
+	};
+
+	/**
+	 * \brief Collection allocator drawing from an Arena. Disposing is a no-op, since the arena reclaims the memory on
+	 *		  'Rewind'/'Reset'. A default constructed ArenaAllocator has no arena and uses the global heap instead.
+	 * \tparam T Type of elements to allocate
+	 */
+	template <typename T>
+	class ArenaAllocator final
+	{
+	public:
+		constexpr ArenaAllocator() noexcept = default;
+
+		constexpr explicit ArenaAllocator(Arena& arena) noexcept
+			: m_Arena(&arena)
+		{
+		}
+
+		NODISCARD constexpr Arena* GetArena() const noexcept { return m_Arena; }
+
+		NODISCARD size_t Allocate(Memory<T>& data, const size_t currentCapacity, const size_t newCapacity) const noexcept
+		{
+			if (currentCapacity == newCapacity)
+				return currentCapacity;
+
+			data = m_Arena != nullptr ? m_Arena->Allocate<T>(newCapacity) : Alloc<T>(newCapacity);
+			return newCapacity;
+		}
+
+		NODISCARD size_t Reallocate(Memory<T>& data, const size_t size, const size_t currentCapacity,
+		                            const size_t newCapacity) const noexcept
+		{
+			if (currentCapacity == newCapacity)
+				return currentCapacity;
+
+			T* newBlock = m_Arena != nullptr ? m_Arena->Allocate<T>(newCapacity) : Alloc<T>(newCapacity);
+
+			const size_t count = MIN(size, newCapacity);
+			Relocate(data.Data, count, newBlock);
+			for (size_t i = count; i < size; i++)
+				data[i].~T();
+
+			Dispose(data, currentCapacity);
+
+			data = newBlock;
+			return newCapacity;
+		}
+
+		constexpr void ClearMemory(Memory<T>& data, const size_t capacity) const noexcept
+		{
+			for (size_t i = 0; i < capacity; i++)
+				data[i].~T();
+		}
+
+		constexpr void Dispose(Memory<T>& data, const size_t capacity) const noexcept
+		{
+			if (m_Arena == nullptr)
+				Delete(data.Data, capacity);
+		}
+
+	private:
+		Arena* m_Arena = nullptr;
+	};
+}
@@ -10,10 +10,37 @@ namespace Micro
 	{
 		T* Data;
 		u64 Length;
+		u64 Alignment = alignof(T);
 
-		NODISCARD static constexpr Buffer Allocate(const u64 length) noexcept 
+		/// <summary>
+		/// Allocates an uninitialized buffer, aligned to the given power of two (e.g. 32/64 bytes for SIMD loads).
+		/// </summary>
+		/// <param name="length">Number of elements</param>
+		/// <param name="alignment">Alignment of the buffer (raised to 'alignof(T)' if smaller)</param>
+		NODISCARD static constexpr Buffer Allocate(const u64 length, const u64 alignment = alignof(T)) noexcept 
 		{ 
-			return Buffer{ .Data = Alloc<T>(length), .Length = length };
+			return Buffer{ .Data = AlignedAlloc<T>(length, alignment), .Length = length, .Alignment = MAX(alignment, alignof(T)) };
+		}
+
+		/// <summary>
+		/// Resizes the buffer, keeping the first 'MIN(Length, length)' elements. Large buffers are remapped rather
+		/// than copied (see 'AlignedReallocate').
+		/// </summary>
+		/// <param name="length">New number of elements</param>
+		constexpr void Resize(const u64 length) noexcept requires TriviallyRelocatable<T>
+		{
+			Data = AlignedReallocate<T>(Data, Length, length, Alignment);
+			Length = length;
+		}
+
+		/// <summary>
+		/// Frees the buffer. Elements are not destroyed.
+		/// </summary>
+		constexpr void Free() noexcept
+		{
+			AlignedDelete(Data, Length, Alignment);
+			Data = nullptr;
+			Length = 0;
 		}
 
 		NODISCARD constexpr T& operator[](const u64 index) { return Data[index]; }
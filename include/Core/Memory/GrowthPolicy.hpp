@@ -0,0 +1,73 @@
+#pragma once
+#include <bit>
+#include <concepts>
+
+#include "Core/Core.hpp"
+#include "Core/Typedef.hpp"
+
+namespace Micro
+{
+	/// <summary>
+	/// Decides the capacity a container grows to once it runs out of room. 'Grow' gets the current capacity, the
+	/// capacity that is required and the size of an element, and returns a capacity of at least 'required'.
+	/// </summary>
+	template <typename TGrowth>
+	concept GrowthPolicy = requires(const size_t capacity, const size_t required, const size_t elementSize)
+	{
+		{ TGrowth::Grow(capacity, required, elementSize) } -> std::same_as<size_t>;
+	};
+
+	/**
+	 * \brief Multiplies the capacity by 'TNumerator / TDenominator'. Larger factors reallocate less often (lower latency
+	 *		  when appending), smaller ones waste less memory on the unused tail.
+	 * \tparam TNumerator Numerator of the growth factor
+	 * \tparam TDenominator Denominator of the growth factor
+	 */
+	template <size_t TNumerator, size_t TDenominator = 1>
+	struct GeometricGrowth final
+	{
+		static_assert(TDenominator != 0 && TNumerator > TDenominator, "Growth factor must be greater than one.");
+
+		NODISCARD constexpr static size_t Grow(const size_t capacity, const size_t required, const size_t) noexcept
+		{
+			return MAX(capacity + capacity * (TNumerator - TDenominator) / TDenominator, required);
+		}
+	};
+
+	/// <summary>
+	/// Doubles the capacity (default of the heap collections).
+	/// </summary>
+	using DoublingGrowth = GeometricGrowth<2>;
+
+	/**
+	 * \brief Keeps the capacity a power of two (at least doubling it), so it can be used for masking instead of modulo.
+	 */
+	struct PowerOfTwoGrowth final
+	{
+		NODISCARD constexpr static size_t Grow(const size_t capacity, const size_t required, const size_t) noexcept
+		{
+			return std::bit_ceil(MAX(capacity * 2, required));
+		}
+	};
+
+	/**
+	 * \brief Grows by 1.5x, then rounds blocks of a page or more up to a whole number of pages, so the allocator's
+	 *		  slack past the end of a large block becomes usable capacity. Smaller blocks are left unrounded.
+	 * \tparam TPageSize Size of a page in bytes (power of two)
+	 */
+	template <size_t TPageSize = 4096>
+	struct PageRoundedGrowth final
+	{
+		static_assert(std::has_single_bit(TPageSize), "Page size must be a power of two.");
+
+		NODISCARD constexpr static size_t Grow(const size_t capacity, const size_t required, const size_t elementSize) noexcept
+		{
+			const size_t target = GeometricGrowth<3, 2>::Grow(capacity, required, elementSize);
+			const size_t bytes = target * elementSize;
+			if (elementSize == 0 || bytes < TPageSize)
+				return target;
+
+			return ((bytes + TPageSize - 1) & ~(TPageSize - 1)) / elementSize;
+		}
+	};
+}
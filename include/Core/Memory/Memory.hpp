@@ -1,18 +1,43 @@
 #pragma once
+#include <cstring>
 #include <memory>
+#include <new>
 #include <ostream>
+#include <type_traits>
 
 #include "Core/Core.hpp"
 #include "Core/Typedef.hpp"
+#include "Core/Memory/AllocationStats.hpp"
+#include "Core/Memory/VirtualMemory.hpp"
 
 namespace Micro
 {
+	/// <summary>
+	/// Opts a type into being moved with a plain byte copy (no move constructor or destructor calls), e.g. when a
+	/// buffer grows. Trivially copyable types qualify by default; a specialization promises that the type holds no
+	/// pointers into itself, so its bytes stay valid at a new address.
+	/// </summary>
+	template <typename T>
+	constexpr bool IsTriviallyRelocatable = std::is_trivially_copyable_v<T>;
+
+	template <typename T>
+	concept TriviallyRelocatable = IsTriviallyRelocatable<T>;
+
 	template <typename T>
 	constexpr bool Copy(T* source, const size_t sourceSize, T* destination, const size_t destinationSize) noexcept
 	{
 		if (destinationSize < sourceSize)
 			return false;
 
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				std::memmove(destination, source, sourceSize * sizeof(T));
+				return true;
+			}
+		}
+
 		for (size_t i = 0; i < sourceSize; i++)
 			destination[i] = source[i];
 
@@ -25,36 +50,84 @@ namespace Micro
 		if (destinationSize < sourceSize)
 			return false;
 
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				std::memmove(destination, source, sourceSize * sizeof(T));
+				return true;
+			}
+		}
+
 		for (size_t i = 0; i < sourceSize; i++)
 			destination[i] = std::move(source[i]);
 
 		return true;
 	}
 
+	/// <summary>
+	/// Moves the objects into uninitialized memory and ends their lifetime at the source (the ranges may overlap
+	/// when the destination comes first).
+	/// </summary>
+	/// <param name="source">Objects to relocate</param>
+	/// <param name="count">Number of objects</param>
+	/// <param name="destination">Uninitialized memory for the objects</param>
+	template <typename T>
+	constexpr void Relocate(T* source, const size_t count, T* destination) noexcept
+	{
+		if constexpr (TriviallyRelocatable<T>)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				if (count != 0)
+					std::memmove(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+				return;
+			}
+		}
+
+		for (size_t i = 0; i < count; i++)
+		{
+			new(&destination[i]) T(std::move(source[i]));
+			source[i].~T();
+		}
+	}
+
+	/// <summary>
+	/// Relocates the elements from the start index to the end 'amount' places to the right. The 'amount' slots from
+	/// the start index are left uninitialized, ready to be constructed into.
+	/// </summary>
 	template <typename T>
 	constexpr void ShiftRight(T* data, const size_t size, const size_t startIndex, const size_t amount = 1)
 	{
+		if constexpr (TriviallyRelocatable<T>)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				if (size > startIndex)
+					std::memmove(static_cast<void*>(data + startIndex + amount), static_cast<const void*>(data + startIndex), (size - startIndex) * sizeof(T));
+				return;
+			}
+		}
+
+		// Back to front, so no element is overwritten before it moved
 		for (size_t i = size; i > startIndex; i--)
 		{
-			const size_t offset = (i - 1) + amount;
-			auto temp = std::move(data[i - 1]);
-			data[i - 1] = std::move(data[offset]);
-			data[offset] = std::move(temp);
+			new(&data[i - 1 + amount]) T(std::move(data[i - 1]));
+			data[i - 1].~T();
 		}
 	}
 
+	/// <summary>
+	/// Relocates the elements from the start index to the end 'amount' places to the left. The 'amount' slots before
+	/// the start index must not hold live objects (e.g. they were just destroyed).
+	/// </summary>
 	template <typename T>
 	constexpr void ShiftLeft(T* data, const size_t size, const size_t startIndex, const size_t amount = 1)
 	{
-		const size_t length = size - startIndex;
-		for (size_t i = 0; i < length; i++)
-		{
-			const size_t offset = i + startIndex - amount;
-			const size_t index = i + startIndex;
-			auto temp = std::move(data[index]);
-			data[index] = std::move(data[offset]);
-			data[offset] = std::move(temp);
-		}
+		if (size <= startIndex)
+			return;
+
+		Relocate(data + startIndex, size - startIndex, data + startIndex - amount);
 	}
 
 	NODISCARD constexpr size_t GetLength(const char* str) noexcept
@@ -93,18 +166,121 @@ namespace Micro
 		return static_cast<T*>(alloca(size * sizeof(T)));
 	}
 
+	// Alignment that plain 'operator new' already guarantees
+	constexpr size_t DefaultNewAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+	/// <summary>
+	/// Allocates uninitialized storage for the elements. Over-aligned types get storage aligned to 'alignof(T)'.
+	/// </summary>
 	template <typename T>
-	NODISCARD constexpr T* Alloc(const size_t size)
+	NODISCARD constexpr T* Alloc(const size_t size ALLOCATION_SITE)
 	{
-		return static_cast<T*>(operator new(size * sizeof(T)));
+		TRACK_ALLOCATION(T, size * sizeof(T));
+		if constexpr (alignof(T) > DefaultNewAlignment)
+			return static_cast<T*>(operator new(size * sizeof(T), std::align_val_t{ alignof(T) }));
+		else
+			return static_cast<T*>(operator new(size * sizeof(T)));
 	}
 
 	template <typename T>
 	constexpr void Delete(T* block, const size_t size)
 	{
-		::operator delete(block, size * sizeof(T));
+		TRACK_FREE(T, block, size * sizeof(T));
+		if constexpr (alignof(T) > DefaultNewAlignment)
+			::operator delete(block, size * sizeof(T), std::align_val_t{ alignof(T) });
+		else
+			::operator delete(block, size * sizeof(T));
+	}
+
+	/// <summary>
+	/// Allocates uninitialized storage for the elements aligned to the given power of two (e.g. 32/64 bytes for SIMD
+	/// loads or for data that must not share a cache line). Must be freed with 'AlignedDelete' and the same alignment.
+	/// Large blocks (see 'IsLargeAllocation') are mapped from the operating system instead, and are page aligned.
+	/// </summary>
+	/// <param name="size">Number of elements</param>
+	/// <param name="alignment">Alignment of the block (raised to 'alignof(T)' if smaller)</param>
+	template <typename T>
+	NODISCARD constexpr T* AlignedAlloc(const size_t size, const size_t alignment ALLOCATION_SITE)
+	{
+		TRACK_ALLOCATION(T, size * sizeof(T));
+		const size_t blockAlignment = MAX(alignment, alignof(T));
+		if (IsLargeAllocation(size * sizeof(T), blockAlignment))
+		{
+			if (void* block = MapPages(size * sizeof(T)))
+				return static_cast<T*>(block);
+			throw std::bad_alloc();
+		}
+
+		if (blockAlignment > DefaultNewAlignment)
+			return static_cast<T*>(operator new(size * sizeof(T), std::align_val_t{ blockAlignment }));
+		return static_cast<T*>(operator new(size * sizeof(T)));
+	}
+
+	template <typename T>
+	constexpr void AlignedDelete(T* block, const size_t size, const size_t alignment)
+	{
+		TRACK_FREE(T, block, size * sizeof(T));
+		const size_t blockAlignment = MAX(alignment, alignof(T));
+		if (IsLargeAllocation(size * sizeof(T), blockAlignment))
+		{
+			UnmapPages(block, size * sizeof(T));
+			return;
+		}
+
+		if (blockAlignment > DefaultNewAlignment)
+			::operator delete(block, size * sizeof(T), std::align_val_t{ blockAlignment });
+		else
+			::operator delete(block, size * sizeof(T));
+	}
+
+	/// <summary>
+	/// Resizes a block of 'AlignedAlloc' that holds trivially relocatable data, keeping its first 'MIN(size, newSize)'
+	/// elements. When both sizes are large, the pages are remapped instead of copied, so growing a buffer of many
+	/// gigabytes costs no more than growing a small one.
+	/// </summary>
+	/// <param name="block">Block to resize (or null, to allocate)</param>
+	/// <param name="size">Current number of elements the block was allocated with</param>
+	/// <param name="newSize">Requested number of elements</param>
+	/// <param name="alignment">Alignment the block was allocated with</param>
+	template <TriviallyRelocatable T>
+	NODISCARD T* AlignedReallocate(T* block, const size_t size, const size_t newSize, const size_t alignment ALLOCATION_SITE)
+	{
+		const size_t blockAlignment = MAX(alignment, alignof(T));
+		if (block != nullptr && IsLargeAllocation(size * sizeof(T), blockAlignment) &&
+			IsLargeAllocation(newSize * sizeof(T), blockAlignment))
+		{
+			void* newBlock = RemapPages(block, size * sizeof(T), newSize * sizeof(T));
+			if (newBlock == nullptr)
+				throw std::bad_alloc();
+
+			TRACK_FREE(T, block, size * sizeof(T));
+			TRACK_ALLOCATION(T, newSize * sizeof(T));
+			return static_cast<T*>(newBlock);
+		}
+
+		T* newBlock = AlignedAlloc<T>(newSize, alignment FORWARD_ALLOCATION_SITE);
+		if (block != nullptr)
+		{
+			std::memcpy(static_cast<void*>(newBlock), block, MIN(size, newSize) * sizeof(T));
+			AlignedDelete(block, size, alignment);
+		}
+
+		return newBlock;
 	}
 
+	/// <summary>
+	/// Properly aligned, uninitialized room for a fixed number of objects, to construct into with placement new.
+	/// The owner tracks which of them are alive and destroys them.
+	/// </summary>
+	template <typename T, size_t TCount>
+	struct UninitializedStorage final
+	{
+		NODISCARD T* Data() noexcept { return reinterpret_cast<T*>(Bytes); }
+		NODISCARD const T* Data() const noexcept { return reinterpret_cast<const T*>(Bytes); }
+
+		alignas(T) u8 Bytes[TCount * sizeof(T)];
+	};
+
 	enum struct MemStatus : uint8_t { Valid = 0, Invalid = 1 };
 
 	inline std::ostream& operator<<(std::ostream& stream, const MemStatus memStatus) noexcept
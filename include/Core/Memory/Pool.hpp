@@ -0,0 +1,245 @@
+#pragma once
+#include <cstddef>
+
+#include "Core/Core.hpp"
+#include "Core/Typedef.hpp"
+#include "Core/Memory/Memory.hpp"
+
+namespace Micro
+{
+	/**
+	 * \brief Fixed-size object pool (slab allocator). Blocks are carved out of chunks that grow geometrically, and
+	 *		  freed blocks go on an intrusive free list that the next allocation pops, so steady churn never reaches the
+	 *		  global heap. All chunks are released when the pool is destroyed, including blocks that were never freed.
+	 *		  A pool is not thread-safe; use one per owner, or 'ThreadLocal' for blocks that never leave their thread.
+	 * \tparam T Type of the objects stored in the blocks
+	 */
+	template <typename T>
+	class Pool final
+	{
+	public:
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		/// <param name="chunkCapacity">Number of blocks in the first chunk (each further chunk doubles it)</param>
+		constexpr explicit Pool(const size_t chunkCapacity = DefaultChunkCapacity) noexcept
+			: m_NextChunkCapacity(MAX(chunkCapacity, static_cast<size_t>(1)))
+		{
+		}
+
+		Pool(const Pool&) = delete;
+
+		constexpr Pool(Pool&& other) noexcept
+			: m_FreeList(other.m_FreeList), m_Cursor(other.m_Cursor), m_End(other.m_End), m_Chunks(other.m_Chunks),
+			  m_Capacity(other.m_Capacity), m_Live(other.m_Live), m_NextChunkCapacity(other.m_NextChunkCapacity)
+		{
+			other.Forget();
+		}
+
+		~Pool() noexcept { Release(); }
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Number of blocks in all chunks.
+		/// </summary>
+		NODISCARD constexpr size_t Capacity() const noexcept { return m_Capacity; }
+
+		/// <summary>
+		/// Number of blocks handed out and not freed yet.
+		/// </summary>
+		NODISCARD constexpr size_t Live() const noexcept { return m_Live; }
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Utility                          |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Gets an uninitialized block: the most recently freed one, otherwise the next unused block of the newest chunk.
+		/// </summary>
+		NODISCARD T* Allocate() noexcept
+		{
+			++m_Live;
+			if (m_FreeList != nullptr)
+			{
+				Slot* slot = m_FreeList;
+				m_FreeList = slot->Next;
+				return reinterpret_cast<T*>(slot);
+			}
+
+			if (m_Cursor == m_End)
+				AddChunk(m_NextChunkCapacity);
+
+			return reinterpret_cast<T*>(m_Cursor++);
+		}
+
+		/// <summary>
+		/// Gives a block back to the pool. The object in it must already be destroyed.
+		/// </summary>
+		/// <param name="block">Block allocated by this pool</param>
+		void Free(T* block) noexcept
+		{
+			Slot* slot = reinterpret_cast<Slot*>(block);
+			slot->Next = m_FreeList;
+			m_FreeList = slot;
+			--m_Live;
+		}
+
+		template <typename... Args>
+		NODISCARD T* Create(Args&&... args) noexcept
+		{
+			return new(Allocate()) T(std::forward<Args>(args)...);
+		}
+
+		void Destroy(T* object) noexcept
+		{
+			object->~T();
+			Free(object);
+		}
+
+		/// <summary>
+		/// Makes sure the given number of blocks can be allocated without adding another chunk.
+		/// </summary>
+		void Reserve(const size_t count) noexcept
+		{
+			const size_t available = m_Capacity - m_Live;
+			if (count > available)
+				AddChunk(MAX(count - available, m_NextChunkCapacity));
+		}
+
+		/// <summary>
+		/// Pool owned by the calling thread. Its blocks must be freed on that thread and not be used after it exits.
+		/// </summary>
+		NODISCARD static Pool& ThreadLocal() noexcept
+		{
+			thread_local Pool pool;
+			return pool;
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		Pool& operator=(const Pool&) = delete;
+
+		Pool& operator=(Pool&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			Release();
+
+			m_FreeList = other.m_FreeList;
+			m_Cursor = other.m_Cursor;
+			m_End = other.m_End;
+			m_Chunks = other.m_Chunks;
+			m_Capacity = other.m_Capacity;
+			m_Live = other.m_Live;
+			m_NextChunkCapacity = other.m_NextChunkCapacity;
+
+			other.Forget();
+			return *this;
+		}
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		// A free block stores the link to the next free block in place of the object
+		union Slot
+		{
+			Slot* Next;
+			alignas(T) u8 Storage[sizeof(T)];
+		};
+
+		// Header stored in the first slot(s) of every chunk
+		struct Chunk
+		{
+			Chunk* Next;
+			size_t Count;
+		};
+
+		constexpr static size_t HeaderSlots = (sizeof(Chunk) + sizeof(Slot) - 1) / sizeof(Slot);
+
+		void AddChunk(const size_t capacity) noexcept
+		{
+			const size_t count = HeaderSlots + capacity;
+			TRACK_ALLOCATION_OWNER(Pool);
+			Slot* slots = Alloc<Slot>(count);
+
+			Chunk* chunk = reinterpret_cast<Chunk*>(slots);
+			chunk->Next = m_Chunks;
+			chunk->Count = count;
+			m_Chunks = chunk;
+
+			// Unused blocks left in the previous chunk go on the free list, so only the newest chunk is bumped
+			while (m_Cursor != m_End)
+			{
+				m_Cursor->Next = m_FreeList;
+				m_FreeList = m_Cursor++;
+			}
+
+			m_Cursor = slots + HeaderSlots;
+			m_End = slots + count;
+			m_Capacity += capacity;
+			m_NextChunkCapacity = MIN(capacity * 2, MaxChunkCapacity);
+		}
+
+		void Release() noexcept
+		{
+			Chunk* chunk = m_Chunks;
+			while (chunk != nullptr)
+			{
+				Chunk* next = chunk->Next;
+				Delete(reinterpret_cast<Slot*>(chunk), chunk->Count);
+				chunk = next;
+			}
+
+			Forget();
+		}
+
+		constexpr void Forget() noexcept
+		{
+			m_FreeList = nullptr;
+			m_Cursor = nullptr;
+			m_End = nullptr;
+			m_Chunks = nullptr;
+			m_Capacity = 0;
+			m_Live = 0;
+		}
+
+	private:
+		Slot* m_FreeList = nullptr;
+		Slot* m_Cursor = nullptr;
+		Slot* m_End = nullptr;
+		Chunk* m_Chunks = nullptr;
+		size_t m_Capacity = 0;
+		size_t m_Live = 0;
+		size_t m_NextChunkCapacity;
+
+		constexpr static size_t DefaultChunkCapacity = 8;
+		constexpr static size_t MaxChunkCapacity = 1024;
+	};
+}
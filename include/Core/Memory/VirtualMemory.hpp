@@ -0,0 +1,138 @@
+#pragma once
+#include <cstring>
+
+#include "Core/Core.hpp"
+#include "Core/Typedef.hpp"
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Micro
+{
+	// Size of a transparent huge page on x86-64/AArch64 Linux; blocks at least this large ask for them
+	constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+	// Smallest page size of the supported platforms, which every mapping is aligned to
+	constexpr size_t MinPageSize = 4096;
+
+	/// <summary>
+	/// Checks if a block of the given size is mapped straight from the operating system instead of going through
+	/// 'operator new' (see 'LARGE_ALLOCATION_THRESHOLD'). Blocks aligned past a page never are.
+	/// The threshold is fixed at compile time on purpose: a block is freed by asking this again with its size, so
+	/// a threshold that changed while blocks are alive would free them through the wrong path. No address space is
+	/// reserved up front either, so growing a mapped block relies on 'RemapPages': on Linux the kernel extends it in
+	/// place or moves its pages without copying, elsewhere every growth copies into a new mapping.
+	/// </summary>
+	/// <param name="bytes">Size of the block</param>
+	/// <param name="alignment">Alignment of the block</param>
+	NODISCARD constexpr bool IsLargeAllocation(const size_t bytes, const size_t alignment = 1) noexcept
+	{
+		return LARGE_ALLOCATION_THRESHOLD != 0 && bytes >= LARGE_ALLOCATION_THRESHOLD && alignment <= MinPageSize;
+	}
+
+	/// <summary>
+	/// Size of a regular page of virtual memory.
+	/// </summary>
+	NODISCARD inline size_t PageSize() noexcept
+	{
+#if defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
+		static const size_t pageSize = []
+		{
+			SYSTEM_INFO info;
+			GetSystemInfo(&info);
+			return static_cast<size_t>(info.dwPageSize);
+		}();
+#else
+		static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+		return pageSize;
+	}
+
+	/// <summary>
+	/// Asks the kernel to back the block with transparent huge pages, which cuts TLB misses on large buffers.
+	/// A hint only: it does nothing where huge pages are unsupported or disabled.
+	/// </summary>
+	/// <param name="block">Page aligned block returned by 'MapPages'</param>
+	/// <param name="bytes">Size of the block</param>
+	inline void AdviseHugePages(void* block, const size_t bytes) noexcept
+	{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+		if (bytes >= HugePageSize)
+			madvise(block, bytes, MADV_HUGEPAGE);
+#else
+		(void)block;
+		(void)bytes;
+#endif
+	}
+
+	/// <summary>
+	/// Maps zeroed, page aligned memory straight from the operating system. Pages are only committed once touched.
+	/// </summary>
+	/// <param name="bytes">Size of the block</param>
+	/// <returns>Block to free with 'UnmapPages', or null if the address space is exhausted</returns>
+	NODISCARD inline void* MapPages(const size_t bytes) noexcept
+	{
+#if defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
+		return VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+		void* block = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (block == MAP_FAILED)
+			return nullptr;
+
+		AdviseHugePages(block, bytes);
+		return block;
+#endif
+	}
+
+	inline void UnmapPages(void* block, const size_t bytes) noexcept
+	{
+		if (block == nullptr)
+			return;
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
+		(void)bytes;
+		VirtualFree(block, 0, MEM_RELEASE);
+#else
+		munmap(block, bytes);
+#endif
+	}
+
+	/// <summary>
+	/// Resizes a block of 'MapPages'. On Linux the pages are remapped (grown in place when the address space after
+	/// the block is free, otherwise moved by the kernel), so the contents are never copied. Elsewhere the first
+	/// 'MIN(bytes, newBytes)' bytes are copied into a new mapping.
+	/// </summary>
+	/// <param name="block">Block to resize</param>
+	/// <param name="bytes">Current size of the block</param>
+	/// <param name="newBytes">Requested size</param>
+	/// <returns>Resized block, or null (with the old block untouched) if the address space is exhausted</returns>
+	NODISCARD inline void* RemapPages(void* block, const size_t bytes, const size_t newBytes) noexcept
+	{
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+		void* newBlock = mremap(block, bytes, newBytes, MREMAP_MAYMOVE);
+		if (newBlock == MAP_FAILED)
+			return nullptr;
+
+		AdviseHugePages(newBlock, newBytes);
+		return newBlock;
+#else
+		void* newBlock = MapPages(newBytes);
+		if (newBlock == nullptr)
+			return nullptr;
+
+		std::memcpy(newBlock, block, MIN(bytes, newBytes));
+		UnmapPages(block, bytes);
+		return newBlock;
+#endif
+	}
+}
@@ -0,0 +1,413 @@
+#pragma once
+#include <atomic>
+#include <thread>
+
+#include "Common/Span.hpp"
+#include "Collections/MpmcQueue.hpp"
+#include "Core/Core.hpp"
+#include "Core/Function.hpp"
+#include "Core/Typedef.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Core/Threading/WorkStealingDeque.hpp"
+
+namespace Micro
+{
+	/**
+	 * \brief Counts the jobs of a group that haven't finished yet. Jobs submitted with a group add themselves, and
+	 *		  'ThreadPool::Wait' runs other jobs until the count reaches zero. Add/Done can also be called by hand.
+	 */
+	class WaitGroup final
+	{
+	public:
+		WaitGroup() noexcept = default;
+
+		// Jobs refer to their group by address
+		WaitGroup(const WaitGroup&) = delete;
+		WaitGroup(WaitGroup&&) = delete;
+
+		NODISCARD bool IsDone() const noexcept { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+		void Add(const size_t count = 1) noexcept { m_Pending.fetch_add(count, std::memory_order_relaxed); }
+
+		/// <summary>
+		/// Marks one job as finished. Nothing may touch the group after the call that returns true, since its waiter
+		/// can see the count reach zero and destroy the group right away.
+		/// </summary>
+		/// <returns>True, if it was the last one</returns>
+		bool Done() noexcept { return m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+
+		/// <summary>
+		/// Blocks until every job is done, without helping to run them (see 'ThreadPool::Wait'). Spins for a while,
+		/// then yields, since the last 'Done' can't notify a group that may already be gone.
+		/// </summary>
+		void Wait() const noexcept
+		{
+			for (u32 spins = 0; !IsDone(); spins++)
+			{
+				if (spins < SpinCount)
+					CPU_PAUSE();
+				else
+					std::this_thread::yield();
+			}
+		}
+
+		WaitGroup& operator=(const WaitGroup&) = delete;
+		WaitGroup& operator=(WaitGroup&&) = delete;
+
+	private:
+		std::atomic<size_t> m_Pending = 0;
+
+		static constexpr u32 SpinCount = 64;
+	};
+
+
+	/**
+	 * \brief Fixed set of worker threads, each with its own work-stealing deque. Jobs submitted from a worker go to
+	 *		  the bottom of its deque (newest first, cache-hot), jobs from other threads go through a shared queue, and
+	 *		  idle workers steal the oldest jobs of the others before they park. Threads waiting for a group run
+	 *		  pending jobs in the meantime, so jobs may fork and join other jobs without blocking a worker.
+	 */
+	class ThreadPool final
+	{
+		struct Job final
+		{
+			VoidCall Work;
+			WaitGroup* Group;
+		};
+
+		struct alignas(CACHE_LINE_SIZE) Worker final
+		{
+			WorkStealingDeque<Job*> Deque;
+			std::thread Thread;
+		};
+
+		struct CurrentWorker final
+		{
+			const ThreadPool* Pool;
+			size_t Index;
+		};
+
+	public:
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Starts the workers.
+		/// </summary>
+		/// <param name="threadCount">Number of worker threads (at least one)</param>
+		explicit ThreadPool(const size_t threadCount = std::thread::hardware_concurrency()) noexcept
+			: m_ThreadCount(MAX(threadCount, size_t(1)))
+		{
+			// Every deque exists before the first worker starts stealing
+			m_Workers = Alloc<Worker>(m_ThreadCount);
+			for (size_t i = 0; i < m_ThreadCount; i++)
+				new(&m_Workers[i]) Worker();
+
+			for (size_t i = 0; i < m_ThreadCount; i++)
+				m_Workers[i].Thread = std::thread(&ThreadPool::Run, this, i);
+		}
+
+		// Workers refer to the pool by address
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool(ThreadPool&&) = delete;
+
+		/// <summary>
+		/// Runs the jobs that are still pending, then stops the workers.
+		/// </summary>
+		~ThreadPool() noexcept
+		{
+			m_IsStopping.store(true, std::memory_order_release);
+			m_WorkSignal.fetch_add(1, std::memory_order_release);
+			m_WorkSignal.notify_all();
+
+			for (size_t i = 0; i < m_ThreadCount; i++)
+				m_Workers[i].Thread.join();
+
+			for (size_t i = 0; i < m_ThreadCount; i++)
+				m_Workers[i].~Worker();
+			Delete(m_Workers, m_ThreadCount);
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD size_t ThreadCount() const noexcept { return m_ThreadCount; }
+
+		/// <summary>
+		/// Checks if the calling thread is one of this pool's workers.
+		/// </summary>
+		NODISCARD bool IsWorkerThread() const noexcept { return t_CurrentWorker.Pool == this; }
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Utility                          |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Runs the work on a worker, at some point before the pool is destroyed.
+		/// </summary>
+		void Submit(VoidCall work) noexcept { Push(new Job{ std::move(work), nullptr }); }
+
+		/// <summary>
+		/// Runs the work on a worker as part of the group, which must outlive it.
+		/// </summary>
+		void Submit(WaitGroup& group, VoidCall work) noexcept
+		{
+			group.Add();
+			Push(new Job{ std::move(work), &group });
+		}
+
+		/// <summary>
+		/// Runs pending jobs (of any group) until every job of the group is done, and parks while there are none.
+		/// Can be called from jobs, which is how they join the jobs they forked.
+		/// </summary>
+		void Wait(const WaitGroup& group) noexcept
+		{
+			const size_t index = IsWorkerThread() ? t_CurrentWorker.Index : NoWorker;
+			for (u32 idle = 0; !group.IsDone();)
+			{
+				if (Job* job = FindJob(index))
+				{
+					Execute(job);
+					idle = 0;
+				}
+				else if (idle < SpinCount)
+					Pause(idle++);
+				else
+					Park([&] { return group.IsDone() || HasWork(); });
+			}
+		}
+
+		/// <summary>
+		/// Splits [0, count) into chunks and runs the body on each, in parallel (fork/join). The calling thread runs
+		/// the first chunk and helps with the others until all are done.
+		/// </summary>
+		/// <param name="count">Number of indices</param>
+		/// <param name="body">Called as 'body(begin, end)' once per chunk, from any thread</param>
+		/// <param name="grainSize">Indices per chunk (0 makes a few chunks per worker)</param>
+		template <typename TFunc>
+		void ParallelFor(const size_t count, TFunc&& body, const size_t grainSize = 0) noexcept
+		{
+			if (count == 0)
+				return;
+
+			const size_t grain = grainSize != 0 ? grainSize : MAX(count / (m_ThreadCount * ChunksPerThread), size_t(1));
+			if (count <= grain)
+			{
+				body(size_t(0), count);
+				return;
+			}
+
+			WaitGroup group;
+			for (size_t begin = grain; begin < count; begin += grain)
+			{
+				const size_t end = MIN(begin + grain, count);
+				Submit(group, [&body, begin, end] { body(begin, end); });
+			}
+
+			body(size_t(0), grain);
+			Wait(group);
+		}
+
+		/// <summary>
+		/// Runs the body on every element of the span, in parallel (see 'ParallelFor(count, ...)').
+		/// </summary>
+		/// <param name="span">Elements to process</param>
+		/// <param name="body">Called as 'body(element)' with a reference to each element, from any thread</param>
+		/// <param name="grainSize">Elements per chunk (0 makes a few chunks per worker)</param>
+		template <typename T, typename TFunc>
+		void ParallelFor(const Span<T>& span, TFunc&& body, const size_t grainSize = 0) noexcept
+		{
+			T* data = const_cast<T*>(span.Data());
+			ParallelFor(span.Capacity(), [data, &body](const size_t begin, const size_t end)
+			{
+				for (size_t i = begin; i < end; i++)
+					body(data[i]);
+			}, grainSize);
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                          Static                          |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Process-wide pool with one worker per hardware thread, started on first use.
+		/// </summary>
+		NODISCARD static ThreadPool& Default() noexcept
+		{
+			static ThreadPool pool;
+			return pool;
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		ThreadPool& operator=(ThreadPool&&) = delete;
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		void Run(const size_t index) noexcept
+		{
+			t_CurrentWorker = { this, index };
+			for (u32 idle = 0;;)
+			{
+				if (Job* job = FindJob(index))
+				{
+					Execute(job);
+					idle = 0;
+				}
+				else if (m_IsStopping.load(std::memory_order_acquire))
+					break;
+				else if (idle < SpinCount)
+					Pause(idle++);
+				else
+					Park([&] { return HasWork() || m_IsStopping.load(std::memory_order_acquire); });
+			}
+
+			t_CurrentWorker = { nullptr, 0 };
+		}
+
+		void Push(Job* job) noexcept
+		{
+			if (IsWorkerThread())
+				m_Workers[t_CurrentWorker.Index].Deque.Push(job);
+			else
+				(void)m_Injected.Enqueue(job);
+
+			Wake(false);
+		}
+
+		/// <summary>
+		/// Takes a job from the worker's own deque, then from the shared queue, then from the other workers.
+		/// </summary>
+		/// <param name="index">Index of the calling worker, or 'NoWorker'</param>
+		/// <returns>Job, or null if none was found</returns>
+		NODISCARD Job* FindJob(const size_t index) noexcept
+		{
+			if (index != NoWorker)
+				if (Optional<Job*> job = m_Workers[index].Deque.Pop(); job.IsValid())
+					return job.Value();
+
+			if (Optional<Job*> job = m_Injected.TryDequeue(); job.IsValid())
+				return job.Value();
+
+			// Each worker starts with its neighbour, so thieves spread out over the victims
+			const size_t start = index == NoWorker ? 0 : index + 1;
+			for (size_t i = 0; i < m_ThreadCount; i++)
+			{
+				const size_t victim = (start + i) % m_ThreadCount;
+				if (victim == index)
+					continue;
+
+				if (Optional<Job*> job = m_Workers[victim].Deque.Steal(); job.IsValid())
+					return job.Value();
+			}
+
+			return nullptr;
+		}
+
+		NODISCARD bool HasWork() const noexcept
+		{
+			if (!m_Injected.IsEmpty())
+				return true;
+
+			for (size_t i = 0; i < m_ThreadCount; i++)
+				if (!m_Workers[i].Deque.IsEmpty())
+					return true;
+			return false;
+		}
+
+		void Execute(Job* job) noexcept
+		{
+			job->Work();
+			WaitGroup* group = job->Group;
+			delete job;
+
+			// Waiters of the group may be parked on the pool. The group itself may be gone once 'Done' returns true
+			if (group != nullptr && group->Done())
+				Wake(true);
+		}
+
+		static void Pause(const u32 idle) noexcept
+		{
+			for (u32 i = 0; i < (1u << idle); i++)
+				CPU_PAUSE();
+		}
+
+		/// <summary>
+		/// Parks the thread until woken, unless the condition holds after announcing itself as a sleeper.
+		/// </summary>
+		template <typename TFunc>
+		void Park(TFunc&& condition) noexcept
+		{
+			// Read before checking, so a wake between the check and the wait isn't lost
+			const u32 current = m_WorkSignal.load(std::memory_order_acquire);
+			m_Sleepers.fetch_add(1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (!condition())
+				m_WorkSignal.wait(current, std::memory_order_acquire);
+			m_Sleepers.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		/// <summary>
+		/// Wakes parked threads, if there are any. Paired with the fence in 'Park'.
+		/// </summary>
+		void Wake(const bool all) noexcept
+		{
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (m_Sleepers.load(std::memory_order_relaxed) == 0)
+				return;
+
+			m_WorkSignal.fetch_add(1, std::memory_order_release);
+			if (all)
+				m_WorkSignal.notify_all();
+			else
+				m_WorkSignal.notify_one();
+		}
+
+	private:
+		Worker* m_Workers = nullptr;
+		size_t m_ThreadCount;
+		MpmcQueue<Job*> m_Injected{ InjectedCapacity };
+
+		alignas(CACHE_LINE_SIZE) std::atomic<u32> m_WorkSignal = 0;
+		std::atomic<u32> m_Sleepers = 0;
+		std::atomic<bool> m_IsStopping = false;
+
+		inline static thread_local CurrentWorker t_CurrentWorker{ nullptr, 0 };
+
+		static constexpr size_t NoWorker = ~size_t(0);
+		static constexpr size_t ChunksPerThread = 4;
+		static constexpr size_t InjectedCapacity = 4096;
+		static constexpr u32 SpinCount = 8;
+	};
+}
@@ -0,0 +1,219 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <type_traits>
+
+#include "Core/Core.hpp"
+#include "Core/Typedef.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Utility/Options/Optional.hpp"
+
+namespace Micro
+{
+	/**
+	 * \brief Chase-Lev work-stealing deque (with the C11 orderings of Lê et al.). The owning thread pushes and pops at
+	 *		  the bottom like a stack, which keeps recently forked work hot in its cache; any other thread steals the
+	 *		  oldest element from the top. Only the last element is ever contended, and only by a CAS on the top.
+	 *		  The ring doubles when full. Retired rings are kept until destruction, since a thief may still be reading
+	 *		  one, which is cheap because their sizes add up to less than the current ring.
+	 * \tparam T Type of elements (small and trivially copyable, e.g. a pointer to a job)
+	 */
+	template <typename T>
+	class WorkStealingDeque final
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Elements are copied while other threads may read them.");
+
+		struct Ring final
+		{
+			std::atomic<T>* Slots;
+			i64 Capacity;
+			Ring* Previous;
+
+			NODISCARD T Load(const i64 index) const noexcept { return Slots[index & (Capacity - 1)].load(std::memory_order_relaxed); }
+			void Store(const i64 index, const T value) noexcept { Slots[index & (Capacity - 1)].store(value, std::memory_order_relaxed); }
+		};
+
+	public:
+		/*
+		 *  ============================================================
+		 *	|                  Constructors/Destructors                |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Creates an empty deque.
+		/// </summary>
+		/// <param name="capacity">Initial capacity (rounded up to a power of two)</param>
+		explicit WorkStealingDeque(const size_t capacity = DefaultCapacity) noexcept
+		{
+			m_Ring.store(CreateRing(static_cast<i64>(std::bit_ceil(MAX(capacity, size_t(2)))), nullptr), std::memory_order_relaxed);
+		}
+
+		// Thieves refer to the deque by address
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+		WorkStealingDeque(WorkStealingDeque&&) = delete;
+
+		~WorkStealingDeque() noexcept
+		{
+			Ring* ring = m_Ring.load(std::memory_order_relaxed);
+			while (ring != nullptr)
+			{
+				Ring* previous = ring->Previous;
+				Delete(ring->Slots, static_cast<size_t>(ring->Capacity));
+				delete ring;
+				ring = previous;
+			}
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Accessors                        |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Number of elements, which is only a snapshot while thieves are running.
+		/// </summary>
+		NODISCARD size_t Size() const noexcept
+		{
+			const i64 bottom = m_Bottom.load(std::memory_order_relaxed);
+			const i64 top = m_Top.load(std::memory_order_relaxed);
+			return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+		}
+
+		NODISCARD bool IsEmpty() const noexcept { return Size() == 0; }
+
+
+		/*
+		 *  ============================================================
+		 *	|                         Utility                          |
+		 *  ============================================================
+		 */
+
+
+		/// <summary>
+		/// Pushes the value at the bottom. Owner thread only.
+		/// </summary>
+		void Push(const T value) noexcept
+		{
+			const i64 bottom = m_Bottom.load(std::memory_order_relaxed);
+			const i64 top = m_Top.load(std::memory_order_acquire);
+			Ring* ring = m_Ring.load(std::memory_order_relaxed);
+
+			if (bottom - top > ring->Capacity - 1)
+				ring = Grow(ring, top, bottom);
+
+			ring->Store(bottom, value);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		/// <summary>
+		/// Pops the newest element from the bottom. Owner thread only.
+		/// </summary>
+		/// <returns>Newest element, or an empty optional if the deque is empty</returns>
+		NODISCARD Optional<T> Pop() noexcept
+		{
+			const i64 bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			Ring* ring = m_Ring.load(std::memory_order_relaxed);
+
+			// Claims the bottom before looking at the top, so a thief either sees the claim or is seen here
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			i64 top = m_Top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return Optional<T>::Empty();
+			}
+
+			const T value = ring->Load(bottom);
+			if (top == bottom)
+			{
+				// Last element: race the thieves for it
+				const bool won = m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				if (!won)
+					return Optional<T>::Empty();
+			}
+
+			return Optional<T>(value);
+		}
+
+		/// <summary>
+		/// Steals the oldest element from the top. Any thread.
+		/// </summary>
+		/// <returns>Oldest element, or an empty optional if the deque is empty or another thread took it first</returns>
+		NODISCARD Optional<T> Steal() noexcept
+		{
+			i64 top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const i64 bottom = m_Bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return Optional<T>::Empty();
+
+			const T value = m_Ring.load(std::memory_order_acquire)->Load(top);
+			if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return Optional<T>::Empty();
+
+			return Optional<T>(value);
+		}
+
+
+		/*
+		 *  ============================================================
+		 *	|                    Operator Overloads                    |
+		 *  ============================================================
+		 */
+
+
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+		WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+	private:
+		/*
+		 *  ============================================================
+		 *	|                      Internal Helpers                    |
+		 *  ============================================================
+		 */
+
+
+		NODISCARD static Ring* CreateRing(const i64 capacity, Ring* previous) noexcept
+		{
+			TRACK_ALLOCATION_OWNER(WorkStealingDeque);
+			auto* slots = Alloc<std::atomic<T>>(static_cast<size_t>(capacity));
+			for (i64 i = 0; i < capacity; i++)
+				new(&slots[i]) std::atomic<T>();
+
+			return new Ring{ slots, capacity, previous };
+		}
+
+		/// <summary>
+		/// Copies the live elements into a ring twice as large and publishes it. The old ring stays readable.
+		/// </summary>
+		NODISCARD Ring* Grow(Ring* ring, const i64 top, const i64 bottom) noexcept
+		{
+			Ring* grown = CreateRing(ring->Capacity * 2, ring);
+			for (i64 i = top; i < bottom; i++)
+				grown->Store(i, ring->Load(i));
+
+			m_Ring.store(grown, std::memory_order_release);
+			return grown;
+		}
+
+	private:
+		// Stolen from by every thread
+		alignas(CACHE_LINE_SIZE) std::atomic<i64> m_Top = 0;
+
+		// Written by the owner only
+		alignas(CACHE_LINE_SIZE) std::atomic<i64> m_Bottom = 0;
+		std::atomic<Ring*> m_Ring = nullptr;
+
+		static constexpr size_t DefaultCapacity = 256;
+	};
+}
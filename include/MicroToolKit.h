@@ -7,8 +7,16 @@
 #include "Core/Typedef.hpp"
 #include "Core/Hash.hpp"
 
+#include "Core/Memory/AllocationStats.hpp"
 #include "Core/Memory/Memory.hpp"
 #include "Core/Memory/Allocator.hpp"
+#include "Core/Memory/Arena.hpp"
+#include "Core/Memory/Pool.hpp"
+#include "Core/Memory/GrowthPolicy.hpp"
+#include "Core/Memory/VirtualMemory.hpp"
+
+#include "Core/Threading/WorkStealingDeque.hpp"
+#include "Core/Threading/ThreadPool.hpp"
 
 #include "Core/Errors/Error.hpp"
 #include "Core/Errors/IError.hpp"
@@ -21,12 +29,20 @@
 
 // Collection Headers
 #include "Collections/Array.hpp"
+#include "Collections/ConcurrentMap.hpp"
+#include "Collections/FixedList.hpp"
+#include "Collections/FlatMap.hpp"
+#include "Collections/InlineList.hpp"
 #include "Collections/LinkedList.hpp"
 #include "Collections/List.hpp"
-//#include "Collections/Map.hpp"
+#include "Collections/Map.hpp"
+#include "Collections/MpmcQueue.hpp"
+#include "Collections/PriorityQueue.hpp"
 #include "Collections/Queue.hpp"
-//#include "Collections/Set.hpp"
+#include "Collections/Set.hpp"
+#include "Collections/SpscQueue.hpp"
 #include "Collections/Stack.hpp"
+#include "Collections/StaticMap.hpp"
 
 // IO Headers
 #include "IO/FileHandler.hpp"
@@ -34,6 +50,7 @@
 
 // Utility Headers
 #include "Utility/Sort.hpp"
+#include "Utility/Parallel.hpp"
 #include "Utility/Node.hpp"
 #include "Utility/Parse.hpp"
 #include "Utility/ContainerUtils.hpp"
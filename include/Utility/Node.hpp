@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Memory/Memory.hpp"
+#include "Core/Memory/Pool.hpp"
 
 namespace Micro
 {
@@ -21,25 +22,24 @@ namespace Micro
 		public:
 			using Node = SingleNode;
 
-			NODISCARD static size_t Allocate(Node*& head, const size_t newCapacity)
+			NODISCARD static size_t Allocate(Pool<Node>& pool, Node*& head, const size_t newCapacity)
 			{
 				// Allocate head
-				head = CreateEmptyNode();
+				head = CreateEmptyNode(pool);
 
 				// Allocate remaining nodes
 				auto node = head;
 				const size_t length = newCapacity;
 				for (size_t i = 1; i < length; i++, node = node->Next)
 				{
-					auto newNode = CreateEmptyNode();
-					newNode->Prev = node;
+					auto newNode = CreateEmptyNode(pool);
 					node->Next = newNode;
 				}
 
 				return newCapacity;
 			}
 
-			NODISCARD static size_t Reallocate(Node*& head, Node* tail, const size_t currentCapacity,
+			NODISCARD static size_t Reallocate(Pool<Node>& pool, Node*& head, Node* tail, const size_t currentCapacity,
 			                                   const size_t newCapacity)
 			{
 				// Only allocate if greater capacity
@@ -48,45 +48,52 @@ namespace Micro
 
 				// Check if head is valid
 				if (!IsNodeValid(head))
-					return Allocate(head, newCapacity);
+					return Allocate(pool, head, newCapacity);
 
 				// Get tail and allocate new nodes
 				auto node = tail;
 				const size_t length = newCapacity - currentCapacity;
 				for (size_t i = 0; i < length; i++, node = node->Next)
 				{
-					auto newNode = CreateEmptyNode();
-					newNode->Prev = node;
+					auto newNode = CreateEmptyNode(pool);
 					node->Next = newNode;
 				}
 
 				return newCapacity;
 			}
 
-			static void Dispose(Node* head)
+			static void Dispose(Pool<Node>& pool, Node* head)
 			{
 				auto node = head;
 				while (IsNodeValid(node))
 				{
 					auto next = node->Next;
-					node->Invalidate();
-					delete node;
+					DestroyNode(pool, node);
 
 					node = next;
 				}
 			}
 
+			/// <summary>
+			/// Destroys the value of the node and gives the node back to the pool.
+			/// </summary>
+			static void DestroyNode(Pool<Node>& pool, Node* node)
+			{
+				node->Value.~T();
+				node->Invalidate();
+				pool.Free(node);
+			}
+
 			NODISCARD constexpr static bool IsNodeValid(const Node* node) noexcept
 			{
 				return node != nullptr && node->IsValid();
 			}
 
 		private:
-			NODISCARD constexpr static Node* CreateEmptyNode() noexcept
+			NODISCARD static Node* CreateEmptyNode(Pool<Node>& pool) noexcept
 			{
-				auto node = Alloc<Node>(1);
+				auto node = pool.Allocate();
 				node->Next = nullptr;
-				node->Prev = nullptr;
 				node->Status = MemStatus::Invalid;
 				return node;
 			}
@@ -129,17 +136,17 @@ namespace Micro
 		public:
 			using Node = DoubleNode;
 
-			NODISCARD static size_t Allocate(Node*& head, const size_t newCapacity)
+			NODISCARD static size_t Allocate(Pool<Node>& pool, Node*& head, const size_t newCapacity)
 			{
 				// Allocate head
-				head = CreateEmptyNode();
+				head = CreateEmptyNode(pool);
 
 				// Allocate remaining nodes
 				auto node = head;
 				const size_t length = newCapacity;
 				for (size_t i = 1; i < length; i++, node = node->Next)
 				{
-					auto newNode = CreateEmptyNode();
+					auto newNode = CreateEmptyNode(pool);
 					newNode->Prev = node;
 					node->Next = newNode;
 				}
@@ -147,7 +154,7 @@ namespace Micro
 				return newCapacity;
 			}
 
-			NODISCARD static size_t Reallocate(Node*& head, Node* tail, const size_t currentCapacity,
+			NODISCARD static size_t Reallocate(Pool<Node>& pool, Node*& head, Node* tail, const size_t currentCapacity,
 			                                   const size_t newCapacity)
 			{
 				// Only allocate if greater capacity
@@ -156,14 +163,14 @@ namespace Micro
 
 				// Check if head is valid
 				if (!IsNodeValid(head))
-					return Allocate(head, newCapacity);
+					return Allocate(pool, head, newCapacity);
 
 				// Get tail and allocate new nodes
 				auto node = tail;
 				const size_t length = newCapacity - currentCapacity;
 				for (size_t i = 0; i < length; i++, node = node->Next)
 				{
-					auto newNode = CreateEmptyNode();
+					auto newNode = CreateEmptyNode(pool);
 					newNode->Prev = node;
 					node->Next = newNode;
 				}
@@ -171,28 +178,37 @@ namespace Micro
 				return newCapacity;
 			}
 
-			static void Dispose(Node* head)
+			static void Dispose(Pool<Node>& pool, Node* head)
 			{
 				auto node = head;
 				while (IsNodeValid(node))
 				{
 					auto next = node->Next;
-					node->Invalidate();
-					delete node;
+					DestroyNode(pool, node);
 
 					node = next;
 				}
 			}
 
+			/// <summary>
+			/// Destroys the value of the node and gives the node back to the pool.
+			/// </summary>
+			static void DestroyNode(Pool<Node>& pool, Node* node)
+			{
+				node->Value.~T();
+				node->Invalidate();
+				pool.Free(node);
+			}
+
 			NODISCARD constexpr static bool IsNodeValid(const Node* node) noexcept
 			{
 				return node != nullptr && node->IsValid();
 			}
 
 		private:
-			NODISCARD constexpr static Node* CreateEmptyNode() noexcept
+			NODISCARD static Node* CreateEmptyNode(Pool<Node>& pool) noexcept
 			{
-				auto node = Alloc<Node>(1);
+				auto node = pool.Allocate();
 				node->Next = nullptr;
 				node->Prev = nullptr;
 				node->Status = MemStatus::Invalid;
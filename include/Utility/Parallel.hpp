@@ -0,0 +1,199 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
+
+#include "Collections/List.hpp"
+#include "Common/Span.hpp"
+#include "Core/Function.hpp"
+#include "Core/Hash.hpp"
+#include "Core/Threading/ThreadPool.hpp"
+#include "Utility/Sort.hpp"
+
+namespace Micro
+{
+	// Spans shorter than this are processed on the calling thread, where splitting them would cost more than it saves
+	constexpr size_t ParallelThreshold = 4096;
+
+	// Size of the blocks 'ParallelHash' hashes independently. Fixed, so the hash doesn't depend on the thread count
+	constexpr size_t ParallelHashBlockSize = 64 * 1024;
+
+	/// <summary>
+	/// Sorts the sequence in parallel, with the same predicate as 'Sort': an element goes after another if
+	/// 'predicate(element, other)' holds (so 'GreaterThan' sorts ascending). Runs are sorted by the workers, then merged
+	/// pairwise. The predicate must be a strict ordering (e.g. 'GreaterThan', not 'GreaterThanEqual').
+	/// </summary>
+	/// <param name="sequence">Sequence to sort in place</param>
+	/// <param name="predicate">Tells if the left element goes after the right one; called from any thread</param>
+	/// <param name="pool">Pool to run on</param>
+	template <Comparable T>
+	void ParallelSort(Span<T>& sequence, const Func<bool, std::type_identity_t<T>, std::type_identity_t<T>>& predicate = GreaterThan<T>,
+	                  ThreadPool& pool = ThreadPool::Default()) noexcept
+	{
+		T* data = sequence.Data();
+		const size_t size = sequence.Capacity();
+		const auto less = [&predicate](const T& left, const T& right) { return predicate(right, left); };
+
+		if (size < ParallelThreshold || pool.ThreadCount() == 1)
+		{
+			std::sort(data, data + size, less);
+			return;
+		}
+
+		// One run per worker, unless that makes the runs too short to be worth it
+		const size_t runCount = MIN(pool.ThreadCount(), size / (ParallelThreshold / 2));
+		const size_t runLength = (size + runCount - 1) / runCount;
+		pool.ParallelFor(runCount, [&](const size_t begin, const size_t end)
+		{
+			for (size_t run = begin; run < end; run++)
+				std::sort(data + run * runLength, data + MIN((run + 1) * runLength, size), less);
+		}, 1);
+
+		for (size_t width = runLength; width < size; width *= 2)
+		{
+			const size_t mergeCount = (size + 2 * width - 1) / (2 * width);
+			pool.ParallelFor(mergeCount, [&](const size_t begin, const size_t end)
+			{
+				for (size_t merge = begin; merge < end; merge++)
+				{
+					const size_t first = merge * 2 * width;
+					const size_t middle = MIN(first + width, size);
+					std::inplace_merge(data + first, data + middle, data + MIN(first + 2 * width, size), less);
+				}
+			}, 1);
+		}
+	}
+
+	/// <summary>
+	/// Counts the elements that match the predicate, in parallel.
+	/// </summary>
+	/// <param name="span">Elements to count</param>
+	/// <param name="predicate">Predicate to test against; called from any thread</param>
+	/// <param name="pool">Pool to run on</param>
+	/// <returns>Number of matches</returns>
+	template <typename T>
+	NODISCARD uint64_t ParallelCountBy(const Span<T>& span, const Predicate<std::type_identity_t<T>>& predicate,
+	                                   ThreadPool& pool = ThreadPool::Default()) noexcept
+	{
+		if (span.Capacity() < ParallelThreshold)
+			return span.CountBy(predicate);
+
+		const T* data = span.Data();
+		std::atomic<uint64_t> count = 0;
+		pool.ParallelFor(span.Capacity(), [&](const size_t begin, const size_t end)
+		{
+			uint64_t matches = 0;
+			for (size_t i = begin; i < end; i++)
+				if (predicate(data[i]))
+					++matches;
+
+			count.fetch_add(matches, std::memory_order_relaxed);
+		});
+
+		return count.load(std::memory_order_relaxed);
+	}
+
+	/// <summary>
+	/// Finds every element that matches the predicate, in parallel. Matches keep their order.
+	/// </summary>
+	/// <param name="span">Elements to search through</param>
+	/// <param name="predicate">Predicate to test against; called from any thread</param>
+	/// <param name="pool">Pool to run on</param>
+	/// <returns>List of references to the matches</returns>
+	template <typename T>
+	NODISCARD List<Optional<const T&>> ParallelFindAll(const Span<T>& span, const Predicate<std::type_identity_t<T>>& predicate,
+	                                                   ThreadPool& pool = ThreadPool::Default()) noexcept
+	{
+		const T* data = span.Data();
+		const size_t size = span.Capacity();
+
+		// Each chunk collects its own matches, which are joined in chunk order
+		const size_t chunkCount = size < ParallelThreshold ? 1 : pool.ThreadCount() * 4;
+		const size_t chunkLength = (size + chunkCount - 1) / chunkCount;
+
+		List<List<Optional<const T&>>> chunks(chunkCount);
+		for (size_t i = 0; i < chunkCount; i++)
+			chunks.Emplace();
+
+		auto* matches = const_cast<List<Optional<const T&>>*>(chunks.Data());
+		pool.ParallelFor(chunkCount, [&](const size_t begin, const size_t end)
+		{
+			for (size_t chunk = begin; chunk < end; chunk++)
+				for (size_t i = chunk * chunkLength; i < MIN((chunk + 1) * chunkLength, size); i++)
+					if (predicate(data[i]))
+						matches[chunk].Emplace(data[i]);
+		}, 1);
+
+		List<Optional<const T&>> list;
+		for (size_t i = 0; i < chunkCount; i++)
+			list.AddRange(std::move(matches[i]));
+
+		return list;
+	}
+
+	/// <summary>
+	/// Hashes the bytes in parallel: blocks of 'ParallelHashBlockSize' are hashed independently, then combined in
+	/// order. Equal to 'HashBytes' for inputs of at most one block.
+	/// </summary>
+	/// <param name="data">Bytes to hash</param>
+	/// <param name="length">Number of bytes</param>
+	/// <param name="pool">Pool to run on</param>
+	/// <returns>Hash code as a 'size_t'</returns>
+	NODISCARD inline size_t ParallelHash(const char* data, const size_t length, ThreadPool& pool = ThreadPool::Default()) noexcept
+	{
+		if (length <= ParallelHashBlockSize)
+			return HashBytes(data, length);
+
+		const size_t blockCount = (length + ParallelHashBlockSize - 1) / ParallelHashBlockSize;
+		size_t* hashes = Alloc<size_t>(blockCount);
+		pool.ParallelFor(blockCount, [&](const size_t begin, const size_t end)
+		{
+			for (size_t block = begin; block < end; block++)
+			{
+				const size_t offset = block * ParallelHashBlockSize;
+				hashes[block] = HashBytes(data + offset, MIN(ParallelHashBlockSize, length - offset));
+			}
+		});
+
+		size_t hash = HashInteger(length);
+		for (size_t block = 0; block < blockCount; block++)
+			hash = HashCombine(hash, hashes[block]);
+
+		Delete(hashes, blockCount);
+		return hash;
+	}
+
+	/// <summary>
+	/// Hashes the span in parallel: blocks of 'ParallelThreshold' elements are hashed like 'Hash(Span)', then combined
+	/// in order. Equal to 'Hash(Span)' for spans of at most one block.
+	/// </summary>
+	/// <param name="span">Span to hash</param>
+	/// <param name="pool">Pool to run on</param>
+	/// <returns>Hash code as a 'size_t'</returns>
+	template <typename T>
+	NODISCARD size_t ParallelHash(const Span<T>& span, ThreadPool& pool = ThreadPool::Default()) noexcept
+	{
+		const size_t size = span.Capacity();
+		if (size <= ParallelThreshold)
+			return Hash(span);
+
+		const T* data = span.Data();
+		const size_t blockCount = (size + ParallelThreshold - 1) / ParallelThreshold;
+		size_t* hashes = Alloc<size_t>(blockCount);
+		pool.ParallelFor(blockCount, [&](const size_t begin, const size_t end)
+		{
+			for (size_t block = begin; block < end; block++)
+			{
+				const size_t offset = block * ParallelThreshold;
+				hashes[block] = Hash(Span<T>(data + offset, MIN(ParallelThreshold, size - offset)));
+			}
+		});
+
+		size_t hash = HashInteger(size);
+		for (size_t block = 0; block < blockCount; block++)
+			hash = HashCombine(hash, hashes[block]);
+
+		Delete(hashes, blockCount);
+		return hash;
+	}
+}
@@ -7,12 +7,12 @@ namespace Micro
 	template <typename T>
 	concept Comparable = requires(T left, T right)
 	{
-		{ operator>(left, right) } -> std::convertible_to<bool>;
-		{ operator>=(left, right) } -> std::convertible_to<bool>;
-		{ operator<(left, right) } -> std::convertible_to<bool>;
-		{ operator<=(left, right) } -> std::convertible_to<bool>;
-		{ operator==(left, right) } -> std::convertible_to<bool>;
-		{ operator!=(left, right) } -> std::convertible_to<bool>;
+		{ left > right } -> std::convertible_to<bool>;
+		{ left >= right } -> std::convertible_to<bool>;
+		{ left < right } -> std::convertible_to<bool>;
+		{ left <= right } -> std::convertible_to<bool>;
+		{ left == right } -> std::convertible_to<bool>;
+		{ left != right } -> std::convertible_to<bool>;
 	};
 
 	template <Comparable T>
@@ -2,6 +2,9 @@
 
 #include <ostream>
 
+#include "Core/Core.hpp"
+#include "Core/Hash.hpp"
+
 namespace Micro
 {
 	template <typename... T>
@@ -12,6 +15,8 @@ namespace Micro
 	{
 		T Component;
 
+		constexpr Tuple() noexcept = default;
+
 		constexpr Tuple(T component) noexcept
 			: Component(std::move(component))
 		{
@@ -30,6 +35,8 @@ namespace Micro
 		T1 Component1;
 		T2 Component2;
 
+		constexpr Tuple() noexcept = default;
+
 		constexpr Tuple(T1 component1, T2 component2) noexcept
 			: Component1(std::move(component1)), Component2(std::move(component2))
 		{
@@ -49,6 +56,8 @@ namespace Micro
 		T2 Component2;
 		T3 Component3;
 
+		constexpr Tuple() noexcept = default;
+
 		constexpr Tuple(T1 component1, T2 component2, T3 component3) noexcept
 			: Component1(std::move(component1)), Component2(std::move(component2)), Component3(std::move(component3))
 		{
@@ -69,6 +78,8 @@ namespace Micro
 		T3 Component3;
 		T4 Component4;
 
+		constexpr Tuple() noexcept = default;
+
 		constexpr Tuple(T1 component1, T2 component2, T3 component3, T4 component4) noexcept
 			: Component1(std::move(component1)), Component2(std::move(component2)), Component3(std::move(component3)),
 			  Component4(std::move(component4))
@@ -92,6 +103,8 @@ namespace Micro
 		T4 Component4;
 		T5 Component5;
 
+		constexpr Tuple() noexcept = default;
+
 		constexpr Tuple(T1 component1, T2 component2, T3 component3, T4 component4, T5 component5) noexcept
 			: Component1(std::move(component1)), Component2(std::move(component2)), Component3(std::move(component3)),
 			  Component4(std::move(component4)), Component5(std::move(component5))
@@ -111,4 +124,39 @@ namespace Micro
 	{
 		return Tuple<T...>{std::forward<T>(std::move(values))...};
 	}
+
+	/// <summary>
+	/// Hashes the Tuple by combining the hashes of its components in order.
+	/// </summary>
+	/// <param name="tuple">Tuple to hash</param>
+	/// <returns>Hash code as a 'size_t'</returns>
+	template <typename T>
+	NODISCARD size_t Hash(const Tuple<T>& tuple) noexcept
+	{
+		return HashValues(tuple.Component);
+	}
+
+	template <typename T1, typename T2>
+	NODISCARD size_t Hash(const Tuple<T1, T2>& tuple) noexcept
+	{
+		return HashValues(tuple.Component1, tuple.Component2);
+	}
+
+	template <typename T1, typename T2, typename T3>
+	NODISCARD size_t Hash(const Tuple<T1, T2, T3>& tuple) noexcept
+	{
+		return HashValues(tuple.Component1, tuple.Component2, tuple.Component3);
+	}
+
+	template <typename T1, typename T2, typename T3, typename T4>
+	NODISCARD size_t Hash(const Tuple<T1, T2, T3, T4>& tuple) noexcept
+	{
+		return HashValues(tuple.Component1, tuple.Component2, tuple.Component3, tuple.Component4);
+	}
+
+	template <typename T1, typename T2, typename T3, typename T4, typename T5>
+	NODISCARD size_t Hash(const Tuple<T1, T2, T3, T4, T5>& tuple) noexcept
+	{
+		return HashValues(tuple.Component1, tuple.Component2, tuple.Component3, tuple.Component4, tuple.Component5);
+	}
 }